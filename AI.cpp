@@ -1,225 +1,673 @@
-#include "AI.h"
-
-Move AI::getBestMove(const Position& position, uint8_t side, int32_t ms) {
-    std::cout << position << std::endl;
-    StaticEvaluator::evaluate(position.getPieces(),true);
-
-    int64_t start = nsecs;
-    SearchInterrupter::getPtr()->resume();
-
-    std::cout << "Search started." << std::endl;
-
-    int32_t eval;
-    bool gameWasFinished;
-    Move move;
-
-    for (int32_t i = 1; i < 1000; i = i + 1) {
-        std::future<std::tuple<int32_t, bool, Move>> thread = std::async(alphaBeta, position, side, i);
-        bool continueSearch = true;
-        while (thread.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
-            if ((nsecs - start) / 1000000 >= ms) {
-                continueSearch = false;
-                break;
-            }
-            std::this_thread::sleep_for(std::chrono::microseconds(20000));
-        }
-
-        if (continueSearch or i == 1) {
-            std::tie(eval, gameWasFinished, move) = thread.get();
-        }
-        else {
-            SearchInterrupter::getPtr()->interrupt();
-            std::tuple<int32_t, bool, Move> trash = thread.get();
-            break;
-        }
-
-        std::cout << "base depth: " << std::setw(4) << i << ". Evaluation: " << std::setw(6) << (float)eval / 100.0f << " pawns.  Time: " << std::setw(10) << (nsecs - start) / (int32_t)1e+6 << " ms." << std::endl;
-        if (gameWasFinished) {
-            break;
-        }
-    }
-
-    std::cout << "Search finished." << std::endl << std::endl;
-
-    return move;
-}
-std::tuple<int32_t, bool, Move> AI::alphaBeta(const Position& position, uint8_t side, int32_t depthLeft) {
-    if (side == SIDE::WHITE) {
-        return alphaBetaMax(position, INF::NEGATIVE, INF::POSITIVE, depthLeft);
-    }
-    return alphaBetaMin(position, INF::NEGATIVE, INF::POSITIVE, depthLeft);
-}
-std::tuple<int32_t, bool, Move> AI::alphaBetaMin(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent) {
-    if (SearchInterrupter::getPtr()->interrupted()) {
-        return std::make_tuple(0, false, Move());
-    }
-    if (depthLeft == 0) {
-        return std::make_tuple(alphaBetaMinOnlyCaptures(position, alpha, beta), false, Move());
-    }
-    if (position.fiftyMovesRuleDraw() or position.threefoldRepetitionDraw()) {
-        return std::make_tuple(0, true, Move());
-    }
-
-    MoveList moves = LegalMoveGen::generate(position, SIDE::BLACK);
-    moves = MoveSorter::sort(position.getPieces(), moves);
-    Move bestMove;
-    uint8_t bestMoveIndex;
-    bool gameWasFinishedOnBestMove;
-
-    uint8_t tableResult = TranspositionTable::getPtr()->getBestMoveIndex(position.getHash());
-    if (tableResult < moves.getSize()) {
-        std::swap(moves[0], moves[tableResult]);
-    }
-
-    bool check = PsLegalMoveMaskGen::inDanger(position.getPieces(), BOp::bsf(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::KING)), SIDE::BLACK);
-    if (moves.getSize() == 0) {
-        if (check) {
-            return std::make_tuple(INF::POSITIVE - depthLeft, true, Move());
-        }
-        return std::make_tuple(0, true, Move());
-    }
-
-    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
-        Move move = moves[i];
-
-        Position copy = position;
-        copy.move(move);
-        std::tuple<int32_t, bool, Move> a = alphaBetaMax(copy, alpha, beta, depthLeft - !check, depthCurrent + 1);
-        int32_t evaluation = std::get<0>(a);
-        bool gameWasFinished = std::get<1>(a);
-
-        if (evaluation <= alpha) {
-            TranspositionTable::getPtr()->addEntry(position.getHash(), depthCurrent, bestMoveIndex);
-            return std::make_tuple(alpha, gameWasFinishedOnBestMove, bestMove);
-        }
-        if (evaluation < beta) {
-            bestMove = move;
-            bestMoveIndex = i;
-            gameWasFinishedOnBestMove = gameWasFinished;
-            beta = evaluation;
-        }
-    }
-
-    TranspositionTable::getPtr()->addEntry(position.getHash(), depthCurrent, bestMoveIndex);
-    return std::make_tuple(beta, gameWasFinishedOnBestMove, bestMove);
-}
-std::tuple<int32_t, bool, Move> AI::alphaBetaMax(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent) {
-    if (SearchInterrupter::getPtr()->interrupted()) {
-        return std::make_tuple(0, false, Move());
-    }
-    if (depthLeft == 0) {
-        return std::make_tuple(alphaBetaMaxOnlyCaptures(position, alpha, beta), false, Move());
-    }
-    if (position.fiftyMovesRuleDraw() or position.threefoldRepetitionDraw()) {
-        return std::make_tuple(0, true, Move());
-    }
-
-    MoveList moves = LegalMoveGen::generate(position, SIDE::WHITE);
-    moves = MoveSorter::sort(position.getPieces(), moves);
-    Move bestMove;
-    uint8_t bestMoveIndex;
-    bool gameWasFinishedOnBestMove;
-
-    uint8_t tableResult = TranspositionTable::getPtr()->getBestMoveIndex(position.getHash());
-    if (tableResult < moves.getSize()) {
-        std::swap(moves[0], moves[tableResult]);
-    }
-
-    bool check = PsLegalMoveMaskGen::inDanger(position.getPieces(), BOp::bsf(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::KING)), SIDE::WHITE);
-    if (moves.getSize() == 0) {
-        if (check) {
-            return std::make_tuple(INF::NEGATIVE + depthLeft, true, Move());
-        }
-        return std::make_tuple(0, true, Move());
-    }
-
-    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
-        Move move = moves[i];
-
-        Position copy = position;
-        copy.move(move);
-        std::tuple<int32_t, bool, Move> a = alphaBetaMin(copy, alpha, beta, depthLeft - !check, depthCurrent + 1);
-        int32_t evaluation = std::get<0>(a);
-        bool gameWasFinished = std::get<1>(a);
-
-        if (evaluation >= beta) {
-            TranspositionTable::getPtr()->addEntry(position.getHash(), depthCurrent, bestMoveIndex);
-            return std::make_tuple(beta, gameWasFinishedOnBestMove, bestMove);
-        }
-        if (evaluation > alpha) {
-            bestMove = move;
-            bestMoveIndex = i;
-            gameWasFinishedOnBestMove = gameWasFinished;
-            alpha = evaluation;
-        }
-    }
-
-    TranspositionTable::getPtr()->addEntry(position.getHash(), depthCurrent, bestMoveIndex);
-    return std::make_tuple(alpha, gameWasFinishedOnBestMove, bestMove);
-}
-int32_t AI::alphaBetaMinOnlyCaptures(const Position& position, int32_t alpha, int32_t beta) {
-    if (SearchInterrupter::getPtr()->interrupted()) {
-        return 0;
-    }
-
-    int32_t evaluation = StaticEvaluator::evaluate(position.getPieces());
-    if (evaluation <= alpha) {
-        return alpha;
-    }
-    if (evaluation < beta) {
-        beta = evaluation;
-    }
-
-    MoveList moves = LegalMoveGen::generate(position, SIDE::BLACK, true);
-    moves = MoveSorter::sort(position.getPieces(), moves);
-
-    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
-        Move move = moves[i];
-
-        Position copy = position;
-        copy.move(move);
-        evaluation = alphaBetaMaxOnlyCaptures(copy, alpha, beta);
-
-        if (evaluation <= alpha) {
-            return alpha;
-        }
-        if (evaluation < beta) {
-            beta = evaluation;
-        }
-    }
-
-    return beta;
-}
-int32_t AI::alphaBetaMaxOnlyCaptures(const Position& position, int32_t alpha, int32_t beta) {
-    if (SearchInterrupter::getPtr()->interrupted()) {
-        return 0;
-    }
-
-    int32_t evaluation = StaticEvaluator::evaluate(position.getPieces());
-    if (evaluation >= beta) {
-        return beta;
-    }
-    if (evaluation > alpha) {
-        alpha = evaluation;
-    }
-
-    MoveList moves = LegalMoveGen::generate(position, SIDE::WHITE, true);
-    moves = MoveSorter::sort(position.getPieces(), moves);
-
-    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
-        Move move = moves[i];
-
-        Position copy = position;
-        copy.move(move);
-        evaluation = alphaBetaMinOnlyCaptures(copy, alpha, beta);
-
-        if (evaluation >= beta) {
-            return beta;
-        }
-        if (evaluation > alpha) {
-            alpha = evaluation;
-        }
-    }
-
-    return alpha;
-}
+#include "AI.h"
+
+uint64_t AI::nodes = 0;
+int32_t AI::rootDepth = 0;
+bool AI::rootStore = true;
+MoveList AI::excludedMoves;
+
+
+AI::Result AI::getBestMove(const Position& position, uint8_t side, TimeManager& timeManager, const RepetitionHistory& repetitionHistory, uint8_t multiPV, const Callback& callback) {
+    LOG(Log::LEVEL::DEBUG, position);
+    LOG(Log::LEVEL::DEBUG, StaticEvaluator::getBreakdown(position.getPieces()));
+
+    SearchInterrupter::getPtr()->resume();
+    nodes = 0;
+    Syzygy::getPtr()->resetHits();
+
+    LOG(Log::LEVEL::INFO, "Search started. Soft limit: " << timeManager.getSoftLimit() << " ms. Hard limit: " << timeManager.getHardLimit() << " ms.");
+
+    MoveList legalMoves = LegalMoveGen::generate(position, side);
+    MoveList tablebaseMoves = legalMoves;
+    MoveList tablebaseExcluded;
+    int8_t wdl;
+    if (Syzygy::getPtr()->filterRootMoves(position, tablebaseMoves, wdl)) {
+        for (uint8_t i = 0; i < legalMoves.getSize(); i = i + 1) {
+            bool kept = false;
+            for (uint8_t j = 0; j < tablebaseMoves.getSize(); j = j + 1) {
+                kept = kept or (legalMoves[i] == tablebaseMoves[j]);
+            }
+            if (!kept) {
+                tablebaseExcluded.push(legalMoves[i]);
+            }
+        }
+        LOG(Log::LEVEL::INFO, "Tablebase root probe: WDL " << (int32_t)wdl << ", " << (int32_t)tablebaseMoves.getSize() << " of " << (int32_t)legalMoves.getSize() << " moves kept.");
+    }
+
+    uint8_t rootMoves = legalMoves.getSize() - tablebaseExcluded.getSize();
+    multiPV = std::max(std::min(multiPV, rootMoves), (uint8_t)1);
+
+    int32_t eval = 0;
+    bool gameWasFinished = false;
+    Move move;
+    std::vector<Line> lines;
+
+    for (int32_t i = 1; i <= MAX_DEPTH / 2; i = i + 1) {
+        std::vector<Line> iterationLines;
+        MoveList excluded = tablebaseExcluded;
+        bool interrupted = false;
+
+        for (uint8_t k = 0; k < multiPV; k = k + 1) {
+            std::future<std::tuple<int32_t, bool, Move>> thread = std::async(alphaBeta, position, side, i, repetitionHistory, excluded, k == 0);
+            while (thread.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready) {
+                if (timeManager.hardLimitReached() and i != 1) {
+                    SearchInterrupter::getPtr()->interrupt();
+                    break;
+                }
+            }
+
+            std::tuple<int32_t, bool, Move> result = thread.get();
+            if (SearchInterrupter::getPtr()->interrupted()) {
+                if (k == 0 and std::get<2>(result).getFrom() != Move::NONE) {
+                    eval = std::get<0>(result);
+                    move = std::get<2>(result);
+                    LOG(Log::LEVEL::INFO, "base depth: " << std::setw(4) << i << " (partial). Evaluation: " << std::setw(6) << (float)eval / 100.0f << " pawns.  Time: " << std::setw(10) << timeManager.getElapsed() << " ms. Nodes: " << std::setw(10) << nodes << ". TB hits: " << Syzygy::getPtr()->getHits() << ".");
+                }
+                interrupted = true;
+                break;
+            }
+            if (k == 0) {
+                std::tie(eval, gameWasFinished, move) = result;
+            }
+
+            Line line = {std::get<2>(result), std::get<0>(result), getMate(std::get<0>(result), side), MoveList()};
+            line.pv.push(line.move);
+            Position child = position;
+            child.move(line.move);
+            MoveList continuation = getPrincipalVariation(child, Pieces::inverse(side), MAX_PV_LENGTH - 1);
+            for (uint8_t j = 0; j < continuation.getSize(); j = j + 1) {
+                line.pv.push(continuation[j]);
+            }
+            iterationLines.push_back(line);
+            excluded.push(line.move);
+        }
+        if (interrupted) {
+            break;
+        }
+        lines = iterationLines;
+
+        LOG(Log::LEVEL::INFO, "base depth: " << std::setw(4) << i << ". Evaluation: " << std::setw(6) << (float)eval / 100.0f << " pawns.  Time: " << std::setw(10) << timeManager.getElapsed() << " ms. Nodes: " << std::setw(10) << nodes << ". TB hits: " << Syzygy::getPtr()->getHits() << ".");
+        if (callback) {
+            callback(i, lines);
+        }
+        if (gameWasFinished or rootMoves == 1 or (isMate(eval) and MATE - std::abs(eval) <= i)) {
+            break;
+        }
+
+        timeManager.update(move);
+        if (timeManager.softLimitReached()) {
+            break;
+        }
+    }
+
+    LOG(Log::LEVEL::INFO, "Search finished.");
+
+    return {move, eval, getMate(eval, side), lines};
+}
+MoveList AI::getPrincipalVariation(const Position& position, uint8_t side, uint8_t maxLength) {
+    MoveList pv;
+    Position current = position;
+
+    while (pv.getSize() < maxLength) {
+        TranspositionTable::Entry entry = TranspositionTable::getPtr()->getEntry(current.getHash());
+        if (entry.bound == TranspositionTable::NONE) {
+            break;
+        }
+
+        MoveList moves = LegalMoveGen::generate(current, side);
+        uint8_t index = moves.getSize();
+        for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+            if (moves[i] == entry.move) {
+                index = i;
+                break;
+            }
+        }
+        if (index == moves.getSize()) {
+            break;
+        }
+
+        pv.push(moves[index]);
+        current.move(moves[index]);
+        side = Pieces::inverse(side);
+    }
+
+    return pv;
+}
+std::tuple<int32_t, bool, Move> AI::alphaBeta(const Position& position, uint8_t side, int32_t depthLeft, RepetitionHistory repetitionHistory, MoveList excluded, bool store) {
+    repetitionHistory.markRoot();
+    rootDepth = depthLeft;
+    excludedMoves = excluded;
+    rootStore = store;
+
+    if (NNUE::getPtr()->enabled()) {
+        NNUE::getPtr()->refresh(position, 0);
+    }
+
+    if (side == SIDE::WHITE) {
+        return alphaBetaMax(position, repetitionHistory, INF::NEGATIVE, INF::POSITIVE, depthLeft);
+    }
+    return alphaBetaMin(position, repetitionHistory, INF::NEGATIVE, INF::POSITIVE, depthLeft);
+}
+std::tuple<int32_t, bool, Move> AI::alphaBetaMin(const Position& position, RepetitionHistory& repetitionHistory, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent) {
+    if (SearchInterrupter::getPtr()->interrupted()) {
+        return std::make_tuple(0, false, Move());
+    }
+    if (depthLeft == 0) {
+        return std::make_tuple(alphaBetaMinOnlyCaptures(position, alpha, beta, depthCurrent, true), false, Move());
+    }
+    if (position.fiftyMovesRuleDraw()) {
+        return std::make_tuple(0, true, Move());
+    }
+    if (repetitionHistory.draw(position.getHalfmoveClock())) {
+        return std::make_tuple(0, false, Move());
+    }
+
+    if (depthCurrent != 0) {
+        if (MATE - depthCurrent <= alpha) {
+            return std::make_tuple(alpha, false, Move());
+        }
+        if (-MATE + depthCurrent + 1 >= beta) {
+            return std::make_tuple(beta, false, Move());
+        }
+    }
+
+    nodes = nodes + 1;
+
+    TranspositionTable::Entry entry = TranspositionTable::getPtr()->getEntry(position.getHash());
+    entry.score = scoreFromTable(entry.score, depthCurrent);
+    if (depthCurrent != 0 and entry.bound != TranspositionTable::NONE and entry.depth >= depthLeft) {
+        if (entry.bound == TranspositionTable::BOUND::EXACT) {
+            return std::make_tuple(entry.score, false, entry.move);
+        }
+        if (entry.bound == TranspositionTable::BOUND::LOWER and entry.score >= beta) {
+            return std::make_tuple(beta, false, entry.move);
+        }
+        if (entry.bound == TranspositionTable::BOUND::UPPER and entry.score <= alpha) {
+            return std::make_tuple(alpha, false, entry.move);
+        }
+    }
+
+    int32_t tablebaseScore;
+    if (depthCurrent != 0 and probeTablebase(position, alpha, beta, depthLeft, depthCurrent, tablebaseScore)) {
+        return std::make_tuple(tablebaseScore, false, Move());
+    }
+
+    bool check = position.inCheck();
+    MoveList moves;
+    if (check) {
+        moves = LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::EVASIONS>(position);
+    }
+    else {
+        moves = LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::ALL>(position);
+    }
+
+    if (moves.getSize() == 0) {
+        if (check) {
+            return std::make_tuple(MATE - depthCurrent, true, Move());
+        }
+        return std::make_tuple(0, true, Move());
+    }
+
+    int32_t extension = (check and depthCurrent + depthLeft < 2 * rootDepth);
+
+    MoveSorter::sort(position.getPieces(), moves);
+    if (entry.bound != TranspositionTable::NONE) {
+        moveToFront(moves, entry.move);
+    }
+    if (depthCurrent == 0) {
+        excludeRootMoves(moves);
+    }
+
+    Move bestMove = moves[0];
+    bool gameWasFinishedOnBestMove = false;
+    uint8_t bound = TranspositionTable::BOUND::LOWER;
+
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+
+        Position copy = position;
+        copy.move(move);
+        updateEvaluation(copy, depthCurrent + 1);
+        repetitionHistory.push(copy.getHash());
+        std::tuple<int32_t, bool, Move> a = alphaBetaMax(copy, repetitionHistory, alpha, beta, depthLeft - 1 + extension, depthCurrent + 1);
+        repetitionHistory.pop();
+        int32_t evaluation = std::get<0>(a);
+        bool gameWasFinished = std::get<1>(a);
+
+        if (SearchInterrupter::getPtr()->interrupted()) {
+            if (depthCurrent == 0 and i != 0) {
+                return std::make_tuple(beta, false, bestMove);
+            }
+            return std::make_tuple(0, false, Move());
+        }
+        if (evaluation <= alpha) {
+            if (depthCurrent != 0 or rootStore) {
+                TranspositionTable::getPtr()->addEntry(position.getHash(), depthLeft, scoreToTable(alpha, depthCurrent), TranspositionTable::BOUND::UPPER, move);
+            }
+            return std::make_tuple(alpha, gameWasFinished, move);
+        }
+        if (evaluation < beta) {
+            bestMove = move;
+            bound = TranspositionTable::BOUND::EXACT;
+            gameWasFinishedOnBestMove = gameWasFinished;
+            beta = evaluation;
+        }
+    }
+
+    if (depthCurrent != 0 or rootStore) {
+        TranspositionTable::getPtr()->addEntry(position.getHash(), depthLeft, scoreToTable(beta, depthCurrent), bound, bestMove);
+    }
+    return std::make_tuple(beta, gameWasFinishedOnBestMove, bestMove);
+}
+std::tuple<int32_t, bool, Move> AI::alphaBetaMax(const Position& position, RepetitionHistory& repetitionHistory, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent) {
+    if (SearchInterrupter::getPtr()->interrupted()) {
+        return std::make_tuple(0, false, Move());
+    }
+    if (depthLeft == 0) {
+        return std::make_tuple(alphaBetaMaxOnlyCaptures(position, alpha, beta, depthCurrent, true), false, Move());
+    }
+    if (position.fiftyMovesRuleDraw()) {
+        return std::make_tuple(0, true, Move());
+    }
+    if (repetitionHistory.draw(position.getHalfmoveClock())) {
+        return std::make_tuple(0, false, Move());
+    }
+
+    if (depthCurrent != 0) {
+        if (-MATE + depthCurrent >= beta) {
+            return std::make_tuple(beta, false, Move());
+        }
+        if (MATE - depthCurrent - 1 <= alpha) {
+            return std::make_tuple(alpha, false, Move());
+        }
+    }
+
+    nodes = nodes + 1;
+
+    TranspositionTable::Entry entry = TranspositionTable::getPtr()->getEntry(position.getHash());
+    entry.score = scoreFromTable(entry.score, depthCurrent);
+    if (depthCurrent != 0 and entry.bound != TranspositionTable::NONE and entry.depth >= depthLeft) {
+        if (entry.bound == TranspositionTable::BOUND::EXACT) {
+            return std::make_tuple(entry.score, false, entry.move);
+        }
+        if (entry.bound == TranspositionTable::BOUND::LOWER and entry.score >= beta) {
+            return std::make_tuple(beta, false, entry.move);
+        }
+        if (entry.bound == TranspositionTable::BOUND::UPPER and entry.score <= alpha) {
+            return std::make_tuple(alpha, false, entry.move);
+        }
+    }
+
+    int32_t tablebaseScore;
+    if (depthCurrent != 0 and probeTablebase(position, alpha, beta, depthLeft, depthCurrent, tablebaseScore)) {
+        return std::make_tuple(tablebaseScore, false, Move());
+    }
+
+    bool check = position.inCheck();
+    MoveList moves;
+    if (check) {
+        moves = LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::EVASIONS>(position);
+    }
+    else {
+        moves = LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::ALL>(position);
+    }
+
+    if (moves.getSize() == 0) {
+        if (check) {
+            return std::make_tuple(-MATE + depthCurrent, true, Move());
+        }
+        return std::make_tuple(0, true, Move());
+    }
+
+    int32_t extension = (check and depthCurrent + depthLeft < 2 * rootDepth);
+
+    MoveSorter::sort(position.getPieces(), moves);
+    if (entry.bound != TranspositionTable::NONE) {
+        moveToFront(moves, entry.move);
+    }
+    if (depthCurrent == 0) {
+        excludeRootMoves(moves);
+    }
+
+    Move bestMove = moves[0];
+    bool gameWasFinishedOnBestMove = false;
+    uint8_t bound = TranspositionTable::BOUND::UPPER;
+
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+
+        Position copy = position;
+        copy.move(move);
+        updateEvaluation(copy, depthCurrent + 1);
+        repetitionHistory.push(copy.getHash());
+        std::tuple<int32_t, bool, Move> a = alphaBetaMin(copy, repetitionHistory, alpha, beta, depthLeft - 1 + extension, depthCurrent + 1);
+        repetitionHistory.pop();
+        int32_t evaluation = std::get<0>(a);
+        bool gameWasFinished = std::get<1>(a);
+
+        if (SearchInterrupter::getPtr()->interrupted()) {
+            if (depthCurrent == 0 and i != 0) {
+                return std::make_tuple(alpha, false, bestMove);
+            }
+            return std::make_tuple(0, false, Move());
+        }
+        if (evaluation >= beta) {
+            if (depthCurrent != 0 or rootStore) {
+                TranspositionTable::getPtr()->addEntry(position.getHash(), depthLeft, scoreToTable(beta, depthCurrent), TranspositionTable::BOUND::LOWER, move);
+            }
+            return std::make_tuple(beta, gameWasFinished, move);
+        }
+        if (evaluation > alpha) {
+            bestMove = move;
+            bound = TranspositionTable::BOUND::EXACT;
+            gameWasFinishedOnBestMove = gameWasFinished;
+            alpha = evaluation;
+        }
+    }
+
+    if (depthCurrent != 0 or rootStore) {
+        TranspositionTable::getPtr()->addEntry(position.getHash(), depthLeft, scoreToTable(alpha, depthCurrent), bound, bestMove);
+    }
+    return std::make_tuple(alpha, gameWasFinishedOnBestMove, bestMove);
+}
+int32_t AI::alphaBetaMinOnlyCaptures(const Position& position, int32_t alpha, int32_t beta, int32_t depthCurrent, bool checks) {
+    if (SearchInterrupter::getPtr()->interrupted()) {
+        return 0;
+    }
+
+    nodes = nodes + 1;
+
+    if (depthCurrent >= MAX_DEPTH) {
+        return evaluate(position, depthCurrent);
+    }
+
+    TranspositionTable::Entry entry = TranspositionTable::getPtr()->getEntry(position.getHash());
+    entry.score = scoreFromTable(entry.score, depthCurrent);
+    if (entry.bound == TranspositionTable::BOUND::EXACT) {
+        return entry.score;
+    }
+    if (entry.bound == TranspositionTable::BOUND::LOWER and entry.score >= beta) {
+        return beta;
+    }
+    if (entry.bound == TranspositionTable::BOUND::UPPER and entry.score <= alpha) {
+        return alpha;
+    }
+
+    bool check = position.inCheck();
+    int32_t standPat = 0;
+    uint8_t bound = TranspositionTable::BOUND::LOWER;
+    MoveList moves;
+    if (check) {
+        moves = LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::EVASIONS>(position);
+        if (moves.getSize() == 0) {
+            return MATE - depthCurrent;
+        }
+    }
+    else {
+        standPat = evaluate(position, depthCurrent);
+        if (standPat <= alpha) {
+            return alpha;
+        }
+        if (standPat < beta) {
+            bound = TranspositionTable::BOUND::EXACT;
+            beta = standPat;
+        }
+        moves = LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::CAPTURES>(position);
+        if (checks) {
+            MoveList quietChecks = LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::QUIET_CHECKS>(position);
+            for (uint8_t i = 0; i < quietChecks.getSize(); i = i + 1) {
+                moves.push(quietChecks[i]);
+            }
+        }
+    }
+
+    MoveSorter::sort(position.getPieces(), moves);
+    if (entry.bound != TranspositionTable::NONE) {
+        moveToFront(moves, entry.move);
+    }
+    Move bestMove = entry.move;
+
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+
+        bool capture = (move.getDefenderType() != Move::NONE or move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE);
+        if (!check and capture and move.getFlag() < Move::FLAG::PROMOTE_TO_KNIGHT and standPat - captureValue(move) - DELTA_MARGIN >= beta) {
+            continue;
+        }
+
+        Position copy = position;
+        copy.move(move);
+        updateEvaluation(copy, depthCurrent + 1);
+        int32_t evaluation = alphaBetaMaxOnlyCaptures(copy, alpha, beta, depthCurrent + 1);
+
+        if (SearchInterrupter::getPtr()->interrupted()) {
+            return 0;
+        }
+        if (evaluation <= alpha) {
+            TranspositionTable::getPtr()->addEntry(position.getHash(), 0, scoreToTable(alpha, depthCurrent), TranspositionTable::BOUND::UPPER, move);
+            return alpha;
+        }
+        if (evaluation < beta) {
+            bestMove = move;
+            bound = TranspositionTable::BOUND::EXACT;
+            beta = evaluation;
+        }
+    }
+
+    TranspositionTable::getPtr()->addEntry(position.getHash(), 0, scoreToTable(beta, depthCurrent), bound, bestMove);
+    return beta;
+}
+int32_t AI::alphaBetaMaxOnlyCaptures(const Position& position, int32_t alpha, int32_t beta, int32_t depthCurrent, bool checks) {
+    if (SearchInterrupter::getPtr()->interrupted()) {
+        return 0;
+    }
+
+    nodes = nodes + 1;
+
+    if (depthCurrent >= MAX_DEPTH) {
+        return evaluate(position, depthCurrent);
+    }
+
+    TranspositionTable::Entry entry = TranspositionTable::getPtr()->getEntry(position.getHash());
+    entry.score = scoreFromTable(entry.score, depthCurrent);
+    if (entry.bound == TranspositionTable::BOUND::EXACT) {
+        return entry.score;
+    }
+    if (entry.bound == TranspositionTable::BOUND::LOWER and entry.score >= beta) {
+        return beta;
+    }
+    if (entry.bound == TranspositionTable::BOUND::UPPER and entry.score <= alpha) {
+        return alpha;
+    }
+
+    bool check = position.inCheck();
+    int32_t standPat = 0;
+    uint8_t bound = TranspositionTable::BOUND::UPPER;
+    MoveList moves;
+    if (check) {
+        moves = LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::EVASIONS>(position);
+        if (moves.getSize() == 0) {
+            return -MATE + depthCurrent;
+        }
+    }
+    else {
+        standPat = evaluate(position, depthCurrent);
+        if (standPat >= beta) {
+            return beta;
+        }
+        if (standPat > alpha) {
+            bound = TranspositionTable::BOUND::EXACT;
+            alpha = standPat;
+        }
+        moves = LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::CAPTURES>(position);
+        if (checks) {
+            MoveList quietChecks = LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::QUIET_CHECKS>(position);
+            for (uint8_t i = 0; i < quietChecks.getSize(); i = i + 1) {
+                moves.push(quietChecks[i]);
+            }
+        }
+    }
+
+    MoveSorter::sort(position.getPieces(), moves);
+    if (entry.bound != TranspositionTable::NONE) {
+        moveToFront(moves, entry.move);
+    }
+    Move bestMove = entry.move;
+
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+
+        bool capture = (move.getDefenderType() != Move::NONE or move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE);
+        if (!check and capture and move.getFlag() < Move::FLAG::PROMOTE_TO_KNIGHT and standPat + captureValue(move) + DELTA_MARGIN <= alpha) {
+            continue;
+        }
+
+        Position copy = position;
+        copy.move(move);
+        updateEvaluation(copy, depthCurrent + 1);
+        int32_t evaluation = alphaBetaMinOnlyCaptures(copy, alpha, beta, depthCurrent + 1);
+
+        if (SearchInterrupter::getPtr()->interrupted()) {
+            return 0;
+        }
+        if (evaluation >= beta) {
+            TranspositionTable::getPtr()->addEntry(position.getHash(), 0, scoreToTable(beta, depthCurrent), TranspositionTable::BOUND::LOWER, move);
+            return beta;
+        }
+        if (evaluation > alpha) {
+            bestMove = move;
+            bound = TranspositionTable::BOUND::EXACT;
+            alpha = evaluation;
+        }
+    }
+
+    TranspositionTable::getPtr()->addEntry(position.getHash(), 0, scoreToTable(alpha, depthCurrent), bound, bestMove);
+    return alpha;
+}
+bool AI::probeTablebase(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent, int32_t& score) {
+    if (!Syzygy::getPtr()->canProbe(position, depthLeft)) {
+        return false;
+    }
+
+    bool success;
+    int8_t wdl = Syzygy::getPtr()->probeWDL(position, success);
+    if (!success) {
+        return false;
+    }
+
+    score = 0;
+    if (wdl == Syzygy::WDL::WIN) {
+        score = TB_WIN - depthCurrent;
+    }
+    else if (wdl == Syzygy::WDL::LOSS) {
+        score = -TB_WIN + depthCurrent;
+    }
+    if (position.blackToMove()) {
+        score = -score;
+    }
+
+    uint8_t bound = TranspositionTable::BOUND::EXACT;
+    if (score > 0) {
+        bound = TranspositionTable::BOUND::LOWER;
+    }
+    else if (score < 0) {
+        bound = TranspositionTable::BOUND::UPPER;
+    }
+    if (bound == TranspositionTable::BOUND::EXACT or (bound == TranspositionTable::BOUND::LOWER and score >= beta) or (bound == TranspositionTable::BOUND::UPPER and score <= alpha)) {
+        TranspositionTable::getPtr()->addEntry(position.getHash(), depthLeft, scoreToTable(score, depthCurrent), bound, Move());
+        return true;
+    }
+    return false;
+}
+void AI::moveToFront(MoveList& moves, Move move) {
+    for (uint8_t i = 1; i < moves.getSize(); i = i + 1) {
+        if (moves[i] == move) {
+            std::swap(moves[0], moves[i]);
+            return;
+        }
+    }
+}
+void AI::excludeRootMoves(MoveList& moves) {
+    MoveList remaining;
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        bool excluded = false;
+        for (uint8_t j = 0; j < excludedMoves.getSize(); j = j + 1) {
+            if (moves[i] == excludedMoves[j]) {
+                excluded = true;
+                break;
+            }
+        }
+        if (!excluded) {
+            remaining.push(moves[i]);
+        }
+    }
+    moves = remaining;
+}
+bool AI::isMate(int32_t score) {
+    return (std::abs(score) >= MATE - MAX_DEPTH);
+}
+int32_t AI::getMate(int32_t score, uint8_t side) {
+    if (!isMate(score)) {
+        return 0;
+    }
+    int32_t mate = (MATE - std::abs(score) + 1) / 2;
+    if ((score > 0) != (side == SIDE::WHITE)) {
+        mate = -mate;
+    }
+    return mate;
+}
+int32_t AI::scoreToTable(int32_t score, int32_t depthCurrent) {
+    if (score >= TB_WIN - MAX_DEPTH) {
+        return score + depthCurrent;
+    }
+    if (score <= -TB_WIN + MAX_DEPTH) {
+        return score - depthCurrent;
+    }
+    return score;
+}
+int32_t AI::scoreFromTable(int32_t score, int32_t depthCurrent) {
+    if (score >= TB_WIN - MAX_DEPTH) {
+        return score - depthCurrent;
+    }
+    if (score <= -TB_WIN + MAX_DEPTH) {
+        return score + depthCurrent;
+    }
+    return score;
+}
+int32_t AI::captureValue(Move move) {
+    switch (move.getDefenderType()) {
+    case PIECE::KNIGHT:
+        return StaticEvaluatorParameters::MATERIAL::KNIGHT;
+    case PIECE::BISHOP:
+        return StaticEvaluatorParameters::MATERIAL::BISHOP;
+    case PIECE::ROOK:
+        return StaticEvaluatorParameters::MATERIAL::ROOK;
+    case PIECE::QUEEN:
+        return StaticEvaluatorParameters::MATERIAL::QUEEN;
+    default:
+        return StaticEvaluatorParameters::MATERIAL::PAWN;
+    }
+}
+int32_t AI::evaluate(const Position& position, int32_t depthCurrent) {
+    int32_t evaluation;
+    if (NNUE::getPtr()->enabled() and depthCurrent < NNUE::MAX_PLY) {
+        evaluation = NNUE::getPtr()->evaluate(position, depthCurrent);
+    }
+    else {
+        evaluation = StaticEvaluator::evaluate(position.getPieces());
+    }
+
+    bool success;
+    int8_t result = Bitbases::getPtr()->probe(position, success);
+    if (success) {
+        if (result == Bitbases::RESULT::DRAW) {
+            return 0;
+        }
+        return evaluation + result * BITBASE_WIN;
+    }
+    return evaluation;
+}
+void AI::updateEvaluation(const Position& position, int32_t depthCurrent) {
+    if (NNUE::getPtr()->enabled() and depthCurrent < NNUE::MAX_PLY) {
+        NNUE::getPtr()->update(position, depthCurrent);
+    }
+}
\ No newline at end of file
@@ -1,33 +1,82 @@
-#include <chrono>
-#include <future>
-#include <iomanip>
-
-#include "LegalMoveGen.h"
-#include "MoveSorter.h"
-#include "TranspositionTable.h"
-#include "SearchInterrupter.h"
-
-
-#pragma once
-
-
-#define nsecs std::chrono::high_resolution_clock::now().time_since_epoch().count()
-
-
-class AI {
-public:
-    static Move getBestMove(const Position& position, uint8_t side, int32_t ms);
-private:
-    static std::tuple<int32_t, bool, Move> alphaBeta(const Position& position, uint8_t side, int32_t depthLeft);
-
-    static std::tuple<int32_t, bool, Move> alphaBetaMin(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent = 0);
-    static std::tuple<int32_t, bool, Move> alphaBetaMax(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent = 0);
-
-    static int32_t alphaBetaMinOnlyCaptures(const Position& position, int32_t alpha, int32_t beta);
-    static int32_t alphaBetaMaxOnlyCaptures(const Position& position, int32_t alpha, int32_t beta);
-
-    struct INF {
-        static constexpr int32_t NEGATIVE = -1e+9;
-        static constexpr int32_t POSITIVE = 1e+9;
-    };
+#include <chrono>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <vector>
+
+#include "LegalMoveGen.h"
+#include "MoveSorter.h"
+#include "TranspositionTable.h"
+#include "SearchInterrupter.h"
+#include "TimeManager.h"
+#include "RepetitionHistory.h"
+#include "NNUE.h"
+#include "Syzygy.h"
+#include "Bitbases.h"
+#include "Log.h"
+
+
+#pragma once
+
+
+#define nsecs std::chrono::high_resolution_clock::now().time_since_epoch().count()
+
+
+class AI {
+public:
+    struct Line {
+        Move move;
+        int32_t evaluation;
+        int32_t mate;
+        MoveList pv;
+    };
+    struct Result {
+        Move move;
+        int32_t evaluation;
+        int32_t mate;
+        std::vector<Line> lines;
+    };
+    using Callback = std::function<void(int32_t depth, const std::vector<Line>& lines)>;
+
+    static Result getBestMove(const Position& position, uint8_t side, TimeManager& timeManager, const RepetitionHistory& repetitionHistory, uint8_t multiPV = 1, const Callback& callback = nullptr);
+    static MoveList getPrincipalVariation(const Position& position, uint8_t side, uint8_t maxLength);
+private:
+    static std::tuple<int32_t, bool, Move> alphaBeta(const Position& position, uint8_t side, int32_t depthLeft, RepetitionHistory repetitionHistory, MoveList excluded, bool store);
+
+    static std::tuple<int32_t, bool, Move> alphaBetaMin(const Position& position, RepetitionHistory& repetitionHistory, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent = 0);
+    static std::tuple<int32_t, bool, Move> alphaBetaMax(const Position& position, RepetitionHistory& repetitionHistory, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent = 0);
+
+    static int32_t alphaBetaMinOnlyCaptures(const Position& position, int32_t alpha, int32_t beta, int32_t depthCurrent, bool checks = false);
+    static int32_t alphaBetaMaxOnlyCaptures(const Position& position, int32_t alpha, int32_t beta, int32_t depthCurrent, bool checks = false);
+
+    static bool probeTablebase(const Position& position, int32_t alpha, int32_t beta, int32_t depthLeft, int32_t depthCurrent, int32_t& score);
+
+    static void moveToFront(MoveList& moves, Move move);
+    static void excludeRootMoves(MoveList& moves);
+    static int32_t captureValue(Move move);
+
+    static bool isMate(int32_t score);
+    static int32_t getMate(int32_t score, uint8_t side);
+    static int32_t scoreToTable(int32_t score, int32_t depthCurrent);
+    static int32_t scoreFromTable(int32_t score, int32_t depthCurrent);
+
+    static int32_t evaluate(const Position& position, int32_t depthCurrent);
+    static void updateEvaluation(const Position& position, int32_t depthCurrent);
+
+    static uint64_t nodes;
+    static int32_t rootDepth;
+    static MoveList excludedMoves;
+    static bool rootStore;
+
+    static constexpr int32_t DELTA_MARGIN = 200;
+    static constexpr int32_t MAX_DEPTH = 128;
+    static constexpr int32_t MATE = 1e+8;
+    static constexpr int32_t TB_WIN = MATE - 2 * MAX_DEPTH;
+    static constexpr int32_t BITBASE_WIN = 10000;
+    static constexpr uint8_t MAX_PV_LENGTH = 16;
+
+    struct INF {
+        static constexpr int32_t NEGATIVE = -1e+9;
+        static constexpr int32_t POSITIVE = 1e+9;
+    };
 };
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "SlidersMasks.h"
+
+
+#pragma once
+
+
+namespace BetweenMasks {
+    static consteval std::array<std::array<Bitboard, 64>, 64> calcMasks() {
+        std::array<std::array<Bitboard, 64>, 64> masks{};
+
+        for (uint8_t from = 0; from < 64; from = from + 1) {
+            for (uint8_t direction = 0; direction < 8; direction = direction + 1) {
+                Bitboard ray = SlidersMasks::MASKS[from][direction];
+                while (ray) {
+                    uint8_t to = BOp::bsf(ray);
+                    ray = BOp::set0(ray, to);
+
+                    masks[from][to] = BOp::set0(SlidersMasks::MASKS[from][direction] ^ SlidersMasks::MASKS[to][direction], to);
+                }
+            }
+        }
+
+        return masks;
+    }
+    static constexpr std::array<std::array<Bitboard, 64>, 64> MASKS = calcMasks();
+}
\ No newline at end of file
@@ -0,0 +1,476 @@
+#include "Bitbases.h"
+
+
+Bitbases* Bitbases::bitbases = nullptr;
+
+
+Bitbases* Bitbases::getPtr() {
+    if (bitbases == nullptr) {
+        bitbases = new Bitbases();
+    }
+    return bitbases;
+}
+bool Bitbases::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::array<uint32_t, 3> header{};
+    file.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+    if (!file or header[0] != MAGIC or header[1] != VERSION or header[2] != this->tables.size()) {
+        return false;
+    }
+
+    std::array<std::vector<uint64_t>, MATERIALS.size()> loadedBits;
+    for (uint8_t i = 0; i < this->tables.size(); i = i + 1) {
+        loadedBits[i].resize((this->tables[i].size + 63) / 64);
+        file.read(reinterpret_cast<char*>(loadedBits[i].data()), (std::streamsize)(loadedBits[i].size() * sizeof(uint64_t)));
+    }
+    if (!file) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < this->tables.size(); i = i + 1) {
+        this->tables[i].bits = std::move(loadedBits[i]);
+    }
+    this->complete.store(true, std::memory_order_release);
+    return true;
+}
+bool Bitbases::save(const std::string& path) const {
+    if (!this->ready()) {
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::array<uint32_t, 3> header = { MAGIC, VERSION, (uint32_t)this->tables.size() };
+    file.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+    for (const Table& table : this->tables) {
+        file.write(reinterpret_cast<const char*>(table.bits.data()), (std::streamsize)(table.bits.size() * sizeof(uint64_t)));
+    }
+    return (bool)file;
+}
+void Bitbases::generate(uint32_t threads) {
+    if (this->ready()) {
+        return;
+    }
+
+    threads = std::max(1u, threads);
+    for (Table& table : this->tables) {
+        if (!this->generateTable(table, threads)) {
+            return;
+        }
+    }
+    this->complete.store(true, std::memory_order_release);
+}
+void Bitbases::stop() {
+    this->stopped = true;
+}
+bool Bitbases::ready() const {
+    return this->complete.load(std::memory_order_acquire);
+}
+int8_t Bitbases::probe(const Position& position, bool& success) const {
+    success = false;
+
+    const Pieces& pieces = position.getPieces();
+    if (!this->ready() or BOp::count1(pieces.getAllBitboard()) > 4) {
+        return RESULT::DRAW;
+    }
+
+    uint8_t strong;
+    if (pieces.getSideBitboard(SIDE::BLACK) == pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING)) {
+        strong = SIDE::WHITE;
+    }
+    else if (pieces.getSideBitboard(SIDE::WHITE) == pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING)) {
+        strong = SIDE::BLACK;
+    }
+    else {
+        return RESULT::DRAW;
+    }
+
+    uint8_t flip = (strong == SIDE::WHITE) ? 0 : 56;
+
+    Setup setup{};
+    setup.side = position.whiteToMove() ? SIDE::WHITE : SIDE::BLACK;
+    if (strong == SIDE::BLACK) {
+        setup.side = Pieces::inverse(setup.side);
+    }
+    setup.whiteKing = BOp::bsf(pieces.getPieceBitboard(strong, PIECE::KING)) ^ flip;
+    setup.blackKing = BOp::bsf(pieces.getPieceBitboard(Pieces::inverse(strong), PIECE::KING)) ^ flip;
+
+    std::array<uint8_t, 2> types = { Pieces::NONE, Pieces::NONE };
+    uint8_t count = 0;
+    for (int8_t type = PIECE::QUEEN; type >= PIECE::PAWN; type = type - 1) {
+        Bitboard bb = pieces.getPieceBitboard(strong, type);
+        while (bb) {
+            uint8_t square = BOp::bsf(bb);
+            bb = BOp::set0(bb, square);
+            types[count] = type;
+            setup.squares[count] = square ^ flip;
+            count = count + 1;
+        }
+    }
+
+    const Table* table = this->findTable(types, count);
+    if (table == nullptr) {
+        return RESULT::DRAW;
+    }
+
+    success = true;
+    uint32_t index = getIndex(count, setup);
+    if (!BOp::getBit(table->bits[index / 64], index % 64)) {
+        return RESULT::DRAW;
+    }
+    return (strong == SIDE::WHITE) ? RESULT::WHITE_WINS : RESULT::BLACK_WINS;
+}
+bool Bitbases::generateTable(Table& table, uint32_t threads) const {
+    std::vector<std::atomic<uint8_t>> states(table.size);
+    forEachRange(table.size, threads, [this, &table, &states](uint32_t begin, uint32_t end) {
+        for (uint32_t index = begin; index < end; index = index + 1) {
+            states[index].store(this->initialState(table, index), std::memory_order_relaxed);
+        }
+    });
+
+    std::atomic<bool> changed = true;
+    while (changed) {
+        if (this->stopped) {
+            return false;
+        }
+        changed = false;
+        forEachRange(table.size, threads, [this, &table, &states, &changed](uint32_t begin, uint32_t end) {
+            for (uint32_t index = begin; index < end; index = index + 1) {
+                if (states[index].load(std::memory_order_relaxed) == STATE::UNKNOWN and this->resolves(table, index, states)) {
+                    states[index].store(STATE::WIN, std::memory_order_relaxed);
+                    changed = true;
+                }
+            }
+        });
+    }
+
+    table.bits.assign((table.size + 63) / 64, 0);
+    for (uint32_t index = 0; index < table.size; index = index + 1) {
+        if (states[index].load(std::memory_order_relaxed) == STATE::WIN) {
+            table.bits[index / 64] = BOp::set1(table.bits[index / 64], index % 64);
+        }
+    }
+    return true;
+}
+Bitbases::STATE Bitbases::initialState(const Table& table, uint32_t index) const {
+    Setup setup = getSetup(table.count, index);
+    if (!legal(table.types, table.count, setup)) {
+        return STATE::ILLEGAL;
+    }
+
+    if (setup.side == SIDE::BLACK) {
+        std::array<BlackMove, 8> moves{};
+        bool inCheck;
+        if (blackMoves(table.types, table.count, setup, moves, inCheck) == 0 and inCheck) {
+            return STATE::WIN;
+        }
+    }
+    return STATE::UNKNOWN;
+}
+bool Bitbases::resolves(const Table& table, uint32_t index, const std::vector<std::atomic<uint8_t>>& states) const {
+    Setup setup = getSetup(table.count, index);
+
+    if (setup.side == SIDE::WHITE) {
+        Bitboard occupancy = BOp::set1(BOp::set1(0, setup.whiteKing), setup.blackKing);
+        for (uint8_t i = 0; i < table.count; i = i + 1) {
+            occupancy = BOp::set1(occupancy, setup.squares[i]);
+        }
+
+        Setup next = setup;
+        next.side = SIDE::BLACK;
+
+        Bitboard kingMoves = KingMasks::MASKS[setup.whiteKing] & ~occupancy & ~KingMasks::MASKS[setup.blackKing];
+        while (kingMoves) {
+            next.whiteKing = BOp::bsf(kingMoves);
+            kingMoves = BOp::set0(kingMoves, next.whiteKing);
+            if (states[getIndex(table.count, next)].load(std::memory_order_relaxed) == STATE::WIN) {
+                return true;
+            }
+        }
+        next.whiteKing = setup.whiteKing;
+
+        for (uint8_t i = 0; i < table.count; i = i + 1) {
+            uint8_t from = setup.squares[i];
+
+            Bitboard moves = 0;
+            if (table.types[i] == PIECE::PAWN) {
+                if (!BOp::getBit(occupancy, from + 8)) {
+                    if ((from + 8) / 8 == 7) {
+                        next.squares[i] = from + 8;
+                        for (uint8_t promoted : { PIECE::QUEEN, PIECE::ROOK }) {
+                            std::array<uint8_t, 2> types = table.types;
+                            types[i] = promoted;
+                            if (this->promotionWins(types, table.count, next)) {
+                                return true;
+                            }
+                        }
+                        next.squares[i] = from;
+                        continue;
+                    }
+                    moves = BOp::set1(moves, from + 8);
+                    if (from / 8 == 1 and !BOp::getBit(occupancy, from + 16)) {
+                        moves = BOp::set1(moves, from + 16);
+                    }
+                }
+            }
+            else {
+                moves = attacks(table.types[i], from, occupancy) & ~occupancy;
+            }
+
+            while (moves) {
+                next.squares[i] = BOp::bsf(moves);
+                moves = BOp::set0(moves, next.squares[i]);
+                if (states[getIndex(table.count, next)].load(std::memory_order_relaxed) == STATE::WIN) {
+                    return true;
+                }
+            }
+            next.squares[i] = from;
+        }
+        return false;
+    }
+
+    std::array<BlackMove, 8> moves{};
+    bool inCheck;
+    uint8_t number = blackMoves(table.types, table.count, setup, moves, inCheck);
+    if (number == 0) {
+        return false;
+    }
+
+    for (uint8_t m = 0; m < number; m = m + 1) {
+        Setup next = setup;
+        next.side = SIDE::WHITE;
+        next.blackKing = moves[m].to;
+
+        if (moves[m].captured == Pieces::NONE) {
+            if (states[getIndex(table.count, next)].load(std::memory_order_relaxed) != STATE::WIN) {
+                return false;
+            }
+            continue;
+        }
+
+        std::array<uint8_t, 2> types = table.types;
+        if (moves[m].captured == 0) {
+            types[0] = types[1];
+            next.squares[0] = next.squares[1];
+        }
+        if (!this->whiteToMoveWins(types, table.count - 1, next)) {
+            return false;
+        }
+    }
+    return true;
+}
+bool Bitbases::promotionWins(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup) const {
+    std::array<BlackMove, 8> moves{};
+    bool inCheck;
+    uint8_t number = blackMoves(types, count, setup, moves, inCheck);
+    if (number == 0) {
+        return inCheck;
+    }
+
+    for (uint8_t m = 0; m < number; m = m + 1) {
+        if (moves[m].captured == Pieces::NONE) {
+            continue;
+        }
+
+        Setup next = setup;
+        next.side = SIDE::WHITE;
+        next.blackKing = moves[m].to;
+
+        std::array<uint8_t, 2> remaining = types;
+        if (moves[m].captured == 0) {
+            remaining[0] = remaining[1];
+            next.squares[0] = next.squares[1];
+        }
+        if (!this->whiteToMoveWins(remaining, count - 1, next)) {
+            return false;
+        }
+    }
+    return true;
+}
+bool Bitbases::whiteToMoveWins(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup) const {
+    std::array<uint8_t, 2> sortedTypes = types;
+    Setup sortedSetup = setup;
+    if (count == 2 and sortedTypes[0] < sortedTypes[1]) {
+        std::swap(sortedTypes[0], sortedTypes[1]);
+        std::swap(sortedSetup.squares[0], sortedSetup.squares[1]);
+    }
+
+    const Table* table = this->findTable(sortedTypes, count);
+    if (table != nullptr) {
+        uint32_t index = getIndex(count, sortedSetup);
+        return BOp::getBit(table->bits[index / 64], index % 64);
+    }
+
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        if (sortedTypes[i] == PIECE::QUEEN or sortedTypes[i] == PIECE::ROOK) {
+            return true;
+        }
+    }
+    return false;
+}
+const Bitbases::Table* Bitbases::findTable(const std::array<uint8_t, 2>& types, uint8_t count) const {
+    for (const Table& table : this->tables) {
+        if (table.count != count or table.bits.empty()) {
+            continue;
+        }
+
+        bool same = true;
+        for (uint8_t i = 0; i < count; i = i + 1) {
+            same = (same and table.types[i] == types[i]);
+        }
+        if (same) {
+            return &table;
+        }
+    }
+    return nullptr;
+}
+void Bitbases::forEachRange(uint32_t size, uint32_t threads, const std::function<void(uint32_t, uint32_t)>& function) {
+    uint32_t step = (size + threads - 1) / threads;
+
+    std::vector<std::future<void>> futures;
+    for (uint32_t worker = 0; worker < threads; worker = worker + 1) {
+        uint32_t begin = std::min(size, worker * step);
+        uint32_t end = std::min(size, begin + step);
+        futures.push_back(std::async(std::launch::async, function, begin, end));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+uint32_t Bitbases::getIndex(uint8_t count, const Setup& setup) {
+    uint8_t flip = (setup.whiteKing % 8 >= 4) ? 7 : 0;
+    uint8_t whiteKing = setup.whiteKing ^ flip;
+
+    uint32_t index = setup.side * 32 + whiteKing / 8 * 4 + whiteKing % 8;
+    index = index * 64 + (setup.blackKing ^ flip);
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        index = index * 64 + (setup.squares[i] ^ flip);
+    }
+    return index;
+}
+Bitbases::Setup Bitbases::getSetup(uint8_t count, uint32_t index) {
+    Setup setup{};
+    setup.squares = { Pieces::NONE, Pieces::NONE };
+
+    for (int8_t i = (int8_t)(count - 1); i >= 0; i = i - 1) {
+        setup.squares[i] = index % 64;
+        index = index / 64;
+    }
+    setup.blackKing = index % 64;
+    index = index / 64;
+    setup.whiteKing = index % 32 / 4 * 8 + index % 4;
+    setup.side = index / 32;
+
+    return setup;
+}
+bool Bitbases::legal(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup) {
+    if (setup.whiteKing == setup.blackKing or BOp::getBit(KingMasks::MASKS[setup.whiteKing], setup.blackKing)) {
+        return false;
+    }
+
+    Bitboard occupancy = BOp::set1(BOp::set1(0, setup.whiteKing), setup.blackKing);
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        if (BOp::getBit(occupancy, setup.squares[i])) {
+            return false;
+        }
+        if (types[i] == PIECE::PAWN and (setup.squares[i] / 8 == 0 or setup.squares[i] / 8 == 7)) {
+            return false;
+        }
+        occupancy = BOp::set1(occupancy, setup.squares[i]);
+    }
+
+    return (setup.side == SIDE::BLACK or !BOp::getBit(whiteAttacks(types, count, setup, occupancy), setup.blackKing));
+}
+uint8_t Bitbases::blackMoves(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup, std::array<BlackMove, 8>& moves, bool& inCheck) {
+    Bitboard occupancy = BOp::set1(0, setup.whiteKing);
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        occupancy = BOp::set1(occupancy, setup.squares[i]);
+    }
+
+    Bitboard attacked = whiteAttacks(types, count, setup, occupancy);
+    inCheck = BOp::getBit(attacked, setup.blackKing);
+
+    uint8_t number = 0;
+    Bitboard targets = BOp::set0(KingMasks::MASKS[setup.blackKing], setup.blackKing) & ~attacked;
+    while (targets) {
+        uint8_t to = BOp::bsf(targets);
+        targets = BOp::set0(targets, to);
+
+        uint8_t captured = Pieces::NONE;
+        for (uint8_t i = 0; i < count; i = i + 1) {
+            if (setup.squares[i] == to) {
+                captured = i;
+            }
+        }
+        moves[number] = { to, captured };
+        number = number + 1;
+    }
+    return number;
+}
+Bitboard Bitbases::whiteAttacks(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup, Bitboard occupancy) {
+    Bitboard attacked = KingMasks::MASKS[setup.whiteKing];
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        attacked = attacked | attacks(types[i], setup.squares[i], occupancy);
+    }
+    return attacked;
+}
+Bitboard Bitbases::attacks(uint8_t type, uint8_t square, Bitboard occupancy) {
+    Bitboard result = 0;
+    switch (type) {
+    case PIECE::PAWN:
+        return PawnMasks::ATTACK_MASKS[SIDE::WHITE][square];
+    case PIECE::KNIGHT:
+        return KnightMasks::MASKS[square];
+    case PIECE::BISHOP:
+        for (uint8_t direction = SlidersMasks::DIRECTION::NORTH_WEST; direction <= SlidersMasks::DIRECTION::SOUTH_EAST; direction = direction + 1) {
+            result = result | ray(square, occupancy, direction);
+        }
+        return result;
+    case PIECE::ROOK:
+        for (uint8_t direction = SlidersMasks::DIRECTION::NORTH; direction <= SlidersMasks::DIRECTION::EAST; direction = direction + 1) {
+            result = result | ray(square, occupancy, direction);
+        }
+        return result;
+    case PIECE::QUEEN:
+        for (uint8_t direction = SlidersMasks::DIRECTION::NORTH; direction <= SlidersMasks::DIRECTION::SOUTH_EAST; direction = direction + 1) {
+            result = result | ray(square, occupancy, direction);
+        }
+        return result;
+    default:
+        return result;
+    }
+}
+Bitboard Bitbases::ray(uint8_t square, Bitboard occupancy, uint8_t direction) {
+    Bitboard blockers = SlidersMasks::MASKS[square][direction] & occupancy;
+    if (blockers == 0) {
+        return SlidersMasks::MASKS[square][direction];
+    }
+
+    uint8_t blockingSquare;
+    if (direction == SlidersMasks::DIRECTION::SOUTH or direction == SlidersMasks::DIRECTION::WEST or direction == SlidersMasks::DIRECTION::SOUTH_WEST or direction == SlidersMasks::DIRECTION::SOUTH_EAST) {
+        blockingSquare = BOp::bsr(blockers);
+    }
+    else {
+        blockingSquare = BOp::bsf(blockers);
+    }
+    return SlidersMasks::MASKS[square][direction] ^ SlidersMasks::MASKS[blockingSquare][direction];
+}
+Bitbases::Bitbases() {
+    for (uint8_t i = 0; i < this->tables.size(); i = i + 1) {
+        this->tables[i].types = MATERIALS[i];
+        this->tables[i].count = (MATERIALS[i][1] == Pieces::NONE) ? 1 : 2;
+        this->tables[i].size = 2 * 32 * 64 * 64;
+        if (this->tables[i].count == 2) {
+            this->tables[i].size = this->tables[i].size * 64;
+        }
+    }
+    this->complete = false;
+    this->stopped = false;
+}
\ No newline at end of file
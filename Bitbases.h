@@ -0,0 +1,96 @@
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+#include "Position.h"
+#include "KnightMasks.h"
+#include "KingMasks.h"
+#include "PawnMasks.h"
+#include "SlidersMasks.h"
+
+
+#pragma once
+
+
+class Bitbases {
+public:
+    static Bitbases* getPtr();
+    Bitbases(const Bitbases& donor) = delete;
+
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+    void generate(uint32_t threads);
+    void stop();
+    [[nodiscard]] bool ready() const;
+
+    int8_t probe(const Position& position, bool& success) const;
+
+    enum RESULT {
+        BLACK_WINS = -1,
+        DRAW = 0,
+        WHITE_WINS = 1
+    };
+
+    static constexpr uint32_t MAGIC = 0x4542'4242;
+    static constexpr uint32_t VERSION = 1;
+private:
+    Bitbases();
+
+    struct Table {
+        std::array<uint8_t, 2> types;
+        uint8_t count;
+        uint32_t size;
+        std::vector<uint64_t> bits;
+    };
+    struct Setup {
+        uint8_t side;
+        uint8_t whiteKing;
+        uint8_t blackKing;
+        std::array<uint8_t, 2> squares;
+    };
+    struct BlackMove {
+        uint8_t to;
+        uint8_t captured;
+    };
+
+    enum STATE : uint8_t {
+        UNKNOWN,
+        ILLEGAL,
+        WIN
+    };
+
+    static constexpr std::array<std::array<uint8_t, 2>, 6> MATERIALS = {{
+        {PIECE::QUEEN, Pieces::NONE},
+        {PIECE::ROOK, Pieces::NONE},
+        {PIECE::PAWN, Pieces::NONE},
+        {PIECE::BISHOP, PIECE::PAWN},
+        {PIECE::KNIGHT, PIECE::PAWN},
+        {PIECE::PAWN, PIECE::PAWN}
+    }};
+
+    bool generateTable(Table& table, uint32_t threads) const;
+    [[nodiscard]] STATE initialState(const Table& table, uint32_t index) const;
+    [[nodiscard]] bool resolves(const Table& table, uint32_t index, const std::vector<std::atomic<uint8_t>>& states) const;
+    [[nodiscard]] bool promotionWins(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup) const;
+    [[nodiscard]] bool whiteToMoveWins(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup) const;
+    [[nodiscard]] const Table* findTable(const std::array<uint8_t, 2>& types, uint8_t count) const;
+
+    static void forEachRange(uint32_t size, uint32_t threads, const std::function<void(uint32_t, uint32_t)>& function);
+
+    static uint32_t getIndex(uint8_t count, const Setup& setup);
+    static Setup getSetup(uint8_t count, uint32_t index);
+    static bool legal(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup);
+    static uint8_t blackMoves(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup, std::array<BlackMove, 8>& moves, bool& inCheck);
+    static Bitboard whiteAttacks(const std::array<uint8_t, 2>& types, uint8_t count, const Setup& setup, Bitboard occupancy);
+    static Bitboard attacks(uint8_t type, uint8_t square, Bitboard occupancy);
+    static Bitboard ray(uint8_t square, Bitboard occupancy, uint8_t direction);
+
+    static Bitbases* bitbases;
+
+    std::array<Table, MATERIALS.size()> tables;
+    std::atomic<bool> complete;
+    std::atomic<bool> stopped;
+};
\ No newline at end of file
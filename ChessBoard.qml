@@ -1,61 +1,89 @@
-import QtQuick 2.15
-
-Rectangle {
-    id: chessBoard
-
-    property int cellSize: Math.min(width, height) / 8
-
-    Grid {
-        anchors.fill: parent
-        rows: 8
-        columns: 8
-
-        Repeater {
-            model: 64
-
-            Rectangle {
-                width: cellSize
-                height: cellSize
-                color: {
-                    let row = Math.floor(index / 8);
-                    let col = index % 8;
-                    return (row + col) % 2 === 0 ? "#F1D9B5" : "#B98863";
-                }
-            }
-        }
-    }
-
-    // Компонент для выделения последнего хода
-    Item {
-        id: lastMoveHighlight
-        anchors.fill: parent
-        visible: chessEngine.hasLastMove()
-
-        Rectangle {
-            id: fromSquare
-            width: cellSize
-            height: cellSize
-            x: chessEngine.getLastMoveFrom().x * cellSize
-            y: (7 - chessEngine.getLastMoveFrom().y) * cellSize
-            color: "#FFFF0055" // Полупрозрачный желтый
-            visible: chessEngine.hasLastMove()
-        }
-
-        Rectangle {
-            id: toSquare
-            width: cellSize
-            height: cellSize
-            x: chessEngine.getLastMoveTo().x * cellSize
-            y: (7 - chessEngine.getLastMoveTo().y) * cellSize
-            color: "#FFFF0055" // Полупрозрачный желтый
-            visible: chessEngine.hasLastMove()
-        }
-    }
-
-    Connections {
-        target: chessEngine
-        function onLastMoveChanged() {
-            lastMoveHighlight.visible = chessEngine.hasLastMove()
-        }
-    }
-}
+import QtQuick 2.15
+
+Rectangle {
+    id: chessBoard
+
+    property int cellSize: Math.min(width, height) / 8
+
+    Grid {
+        anchors.fill: parent
+        rows: 8
+        columns: 8
+
+        Repeater {
+            model: 64
+
+            Rectangle {
+                width: cellSize
+                height: cellSize
+                color: {
+                    let row = Math.floor(index / 8);
+                    let col = index % 8;
+                    return (row + col) % 2 === 0 ? "#F1D9B5" : "#B98863";
+                }
+            }
+        }
+    }
+
+    // Компонент для выделения последнего хода
+    Item {
+        id: lastMoveHighlight
+        anchors.fill: parent
+        visible: chessEngine.hasLastMove()
+
+        Rectangle {
+            id: fromSquare
+            width: cellSize
+            height: cellSize
+            x: chessEngine.getLastMoveFrom().x * cellSize
+            y: (7 - chessEngine.getLastMoveFrom().y) * cellSize
+            color: "#FFFF0055" // Полупрозрачный желтый
+            visible: chessEngine.hasLastMove()
+        }
+
+        Rectangle {
+            id: toSquare
+            width: cellSize
+            height: cellSize
+            x: chessEngine.getLastMoveTo().x * cellSize
+            y: (7 - chessEngine.getLastMoveTo().y) * cellSize
+            color: "#FFFF0055" // Полупрозрачный желтый
+            visible: chessEngine.hasLastMove()
+        }
+    }
+
+    // Шкала оценки позиции в режиме анализа (снизу - белые)
+    Rectangle {
+        id: evaluationBar
+        visible: chessEngine.analysisMode
+        width: 20
+        height: parent.height
+        x: -width - 10
+        color: "#404040"
+        border.color: "#5A5A5A"
+        border.width: 1
+
+        // Доля шкалы у белых: при мате вся шкала, иначе оценка, ограниченная ±10 пешками
+        property real whiteShare: chessEngine.analysisMate !== 0
+                                  ? (chessEngine.analysisMate > 0 ? 1.0 : 0.0)
+                                  : 0.5 + Math.max(-1000, Math.min(1000, chessEngine.analysisEvaluation)) / 2000
+
+        Rectangle {
+            width: parent.width
+            height: parent.height * parent.whiteShare
+            anchors.bottom: parent.bottom
+            color: "#F0F0F0"
+
+            Behavior on height {
+                NumberAnimation { duration: 200 }
+            }
+        }
+    }
+
+    Connections {
+        target: chessEngine
+        function onLastMoveChanged() {
+            lastMoveHighlight.visible = chessEngine.hasLastMove()
+        }
+    }
+}
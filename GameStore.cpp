@@ -0,0 +1,319 @@
+#include "GameStore.h"
+
+
+GameStore::GameStore() {
+    this->end = 0;
+    this->sorted = 0;
+    this->indexed = false;
+}
+GameStore::~GameStore() {
+    this->close();
+}
+bool GameStore::open(const std::string& path) {
+    this->close();
+
+    std::error_code error;
+    if (!std::filesystem::exists(path, error)) {
+        std::ofstream created(path, std::ios::binary);
+        created.write(reinterpret_cast<const char*>(&MAGIC), sizeof(MAGIC));
+        created.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+        if (!created) {
+            return false;
+        }
+    }
+
+    this->file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if (!this->read(magic) or !this->read(version) or magic != MAGIC or version != VERSION) {
+        this->file.close();
+        return false;
+    }
+
+    uint64_t size = std::filesystem::file_size(path, error);
+    this->end = sizeof(MAGIC) + sizeof(VERSION);
+    while (this->end < size and this->readRecord(size)) {
+
+    }
+    if (this->end < size) {
+        this->file.close();
+        std::filesystem::resize_file(path, this->end, error);
+        this->file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    return this->file.is_open();
+}
+void GameStore::close() {
+    if (this->file.is_open()) {
+        this->file.flush();
+        this->file.close();
+    }
+    this->end = 0;
+    this->entries.clear();
+    this->live.clear();
+    this->index.clear();
+    this->sorted = 0;
+    this->indexed = false;
+}
+bool GameStore::flush() {
+    this->file.flush();
+    return (bool)this->file;
+}
+bool GameStore::isOpen() const {
+    return this->file.is_open();
+}
+bool GameStore::append(const Header& header, const std::vector<Move>& moves) {
+    Position position;
+    if (!this->isOpen() or moves.size() > MAX_PLIES or !Notation::parseFen(header.startFen, position)) {
+        return false;
+    }
+
+    std::vector<uint16_t> encoded;
+    std::vector<uint64_t> hashes;
+    encoded.reserve(moves.size());
+    hashes.reserve(moves.size() + 1);
+    hashes.push_back(position.getHash().getValue());
+    for (Move move : moves) {
+        encoded.push_back(PolyglotBook::encodeMove(move));
+        position.move(move);
+        hashes.push_back(position.getHash().getValue());
+    }
+
+    Entry entry{header, 0, (uint16_t)moves.size(), false};
+    for (std::string* field : {&entry.header.name, &entry.header.date, &entry.header.gameMode, &entry.header.status, &entry.header.startFen}) {
+        if (field->size() > UINT16_MAX) {
+            field->resize(UINT16_MAX);
+        }
+    }
+    uint32_t strings = entry.header.name.size() + entry.header.date.size() + entry.header.gameMode.size() + entry.header.status.size() + entry.header.startFen.size();
+    uint32_t payload = sizeof(uint8_t) + sizeof(uint16_t) + 5 * sizeof(uint16_t) + strings + encoded.size() * sizeof(uint16_t) + hashes.size() * sizeof(uint64_t);
+
+    this->file.clear();
+    this->file.seekp((std::streamoff)this->end);
+    this->write(RECORD::GAME);
+    this->write(payload);
+    this->write(entry.header.difficulty);
+    this->write(entry.plies);
+    this->writeString(entry.header.name);
+    this->writeString(entry.header.date);
+    this->writeString(entry.header.gameMode);
+    this->writeString(entry.header.status);
+    this->writeString(entry.header.startFen);
+    entry.movesOffset = (uint64_t)this->file.tellp();
+    this->file.write(reinterpret_cast<const char*>(encoded.data()), (std::streamsize)(encoded.size() * sizeof(uint16_t)));
+    this->file.write(reinterpret_cast<const char*>(hashes.data()), (std::streamsize)(hashes.size() * sizeof(uint64_t)));
+    if (!this->file) {
+        return false;
+    }
+
+    auto id = (uint32_t)this->entries.size();
+    this->entries.push_back(std::move(entry));
+    this->live.push_back(id);
+    if (this->indexed) {
+        this->indexGame(id, hashes);
+        if (this->index.size() - this->sorted >= std::max(MIN_MERGE, this->sorted / 8)) {
+            std::sort(this->index.begin() + this->sorted, this->index.end());
+            std::inplace_merge(this->index.begin(), this->index.begin() + this->sorted, this->index.end());
+            this->sorted = this->index.size();
+        }
+    }
+    this->end = this->end + sizeof(uint8_t) + sizeof(uint32_t) + payload;
+    return true;
+}
+bool GameStore::remove(uint32_t slot) {
+    if (!this->isOpen() or slot >= this->live.size()) {
+        return false;
+    }
+
+    uint32_t id = this->live[slot];
+    this->file.clear();
+    this->file.seekp((std::streamoff)this->end);
+    this->write(RECORD::REMOVAL);
+    this->write((uint32_t)sizeof(id));
+    this->write(id);
+    if (!this->file) {
+        return false;
+    }
+
+    this->markRemoved(id);
+    this->end = this->end + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(id);
+    return true;
+}
+uint32_t GameStore::getSize() const {
+    return this->live.size();
+}
+const GameStore::Header& GameStore::getHeader(uint32_t slot) const {
+    return this->entries[this->live[slot]].header;
+}
+uint16_t GameStore::getPlies(uint32_t slot) const {
+    return this->entries[this->live[slot]].plies;
+}
+bool GameStore::load(uint32_t slot, std::vector<Move>& moves) {
+    moves.clear();
+    if (!this->isOpen() or slot >= this->live.size()) {
+        return false;
+    }
+
+    const Entry& entry = this->entries[this->live[slot]];
+    Position position;
+    if (!Notation::parseFen(entry.header.startFen, position)) {
+        return false;
+    }
+
+    std::vector<uint16_t> encoded(entry.plies);
+    this->file.clear();
+    this->file.seekg((std::streamoff)entry.movesOffset);
+    this->file.read(reinterpret_cast<char*>(encoded.data()), (std::streamsize)(encoded.size() * sizeof(uint16_t)));
+    if (!this->file) {
+        return false;
+    }
+
+    moves.reserve(encoded.size());
+    for (uint16_t code : encoded) {
+        Move move = PolyglotBook::decodeMove(position, position.getSide(), code);
+        if (move.getFrom() == Move::NONE) {
+            return false;
+        }
+        moves.push_back(move);
+        position.move(move);
+    }
+    return true;
+}
+std::vector<GameStore::Occurrence> GameStore::find(ZobristHash hash) {
+    std::vector<Occurrence> occurrences;
+    if (!this->indexed and !this->buildIndex()) {
+        return occurrences;
+    }
+
+    uint64_t value = hash.getValue();
+    auto add = [this, value, &occurrences](const IndexEntry& entry) {
+        if (entry.hash == value and !this->entries[entry.id].removed) {
+            occurrences.push_back({this->getSlot(entry.id), entry.ply});
+        }
+    };
+
+    auto sortedEnd = this->index.begin() + (std::ptrdiff_t)this->sorted;
+    for (auto entry = std::lower_bound(this->index.begin(), sortedEnd, IndexEntry{value, 0, 0}); entry != sortedEnd and entry->hash == value; entry = entry + 1) {
+        add(*entry);
+    }
+    for (auto entry = sortedEnd; entry != this->index.end(); entry = entry + 1) {
+        add(*entry);
+    }
+    return occurrences;
+}
+bool GameStore::readRecord(uint64_t size) {
+    this->file.clear();
+    this->file.seekg((std::streamoff)this->end);
+
+    uint8_t kind = 0;
+    uint32_t payload = 0;
+    if (!this->read(kind) or !this->read(payload)) {
+        return false;
+    }
+    uint64_t next = this->end + sizeof(kind) + sizeof(payload) + payload;
+    if (next > size) {
+        return false;
+    }
+
+    if (!this->parseRecord(kind, payload, next) and kind != RECORD::REMOVAL) {
+        Entry entry{};
+        entry.removed = true;
+        this->entries.push_back(std::move(entry));
+    }
+
+    this->end = next;
+    return true;
+}
+bool GameStore::parseRecord(uint8_t kind, uint32_t payload, uint64_t next) {
+    if (kind == RECORD::GAME) {
+        Entry entry{};
+        if (!this->read(entry.header.difficulty) or !this->read(entry.plies)) {
+            return false;
+        }
+        if (!this->readString(entry.header.name) or !this->readString(entry.header.date) or !this->readString(entry.header.gameMode) or
+            !this->readString(entry.header.status) or !this->readString(entry.header.startFen)) {
+            return false;
+        }
+        entry.movesOffset = (uint64_t)this->file.tellg();
+        if (entry.movesOffset + entry.plies * sizeof(uint16_t) + (entry.plies + 1) * sizeof(uint64_t) != next) {
+            return false;
+        }
+        this->live.push_back(this->entries.size());
+        this->entries.push_back(std::move(entry));
+        return true;
+    }
+    if (kind == RECORD::REMOVAL) {
+        uint32_t id = 0;
+        if (payload != sizeof(id) or !this->read(id) or id >= this->entries.size()) {
+            return false;
+        }
+        this->markRemoved(id);
+        return true;
+    }
+    return false;
+}
+bool GameStore::buildIndex() {
+    if (!this->isOpen()) {
+        return false;
+    }
+
+    uint64_t positions = 0;
+    for (uint32_t id : this->live) {
+        positions = positions + this->entries[id].plies + 1;
+    }
+    this->index.clear();
+    this->index.reserve(positions);
+
+    std::vector<uint64_t> hashes;
+    for (uint32_t id : this->live) {
+        const Entry& entry = this->entries[id];
+        hashes.resize(entry.plies + 1);
+        this->file.clear();
+        this->file.seekg((std::streamoff)(entry.movesOffset + entry.plies * sizeof(uint16_t)));
+        this->file.read(reinterpret_cast<char*>(hashes.data()), (std::streamsize)(hashes.size() * sizeof(uint64_t)));
+        if (!this->file) {
+            this->index.clear();
+            return false;
+        }
+        this->indexGame(id, hashes);
+    }
+
+    std::sort(this->index.begin(), this->index.end());
+    this->sorted = this->index.size();
+    this->indexed = true;
+    return true;
+}
+void GameStore::indexGame(uint32_t id, const std::vector<uint64_t>& hashes) {
+    for (size_t ply = 0; ply < hashes.size(); ply = ply + 1) {
+        this->index.push_back({hashes[ply], id, (uint16_t)ply});
+    }
+}
+void GameStore::markRemoved(uint32_t id) {
+    this->entries[id].removed = true;
+    auto slot = std::lower_bound(this->live.begin(), this->live.end(), id);
+    if (slot != this->live.end() and *slot == id) {
+        this->live.erase(slot);
+    }
+}
+uint32_t GameStore::getSlot(uint32_t id) const {
+    return std::lower_bound(this->live.begin(), this->live.end(), id) - this->live.begin();
+}
+template<typename T> void GameStore::write(T value) {
+    this->file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+template<typename T> bool GameStore::read(T& value) {
+    this->file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return (bool)this->file;
+}
+void GameStore::writeString(const std::string& value) {
+    this->write((uint16_t)value.size());
+    this->file.write(value.data(), (std::streamsize)value.size());
+}
+bool GameStore::readString(std::string& value) {
+    uint16_t size = 0;
+    if (!this->read(size)) {
+        return false;
+    }
+    value.resize(size);
+    this->file.read(value.data(), size);
+    return (bool)this->file;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Notation.h"
+#include "PolyglotBook.h"
+
+
+#pragma once
+
+
+class GameStore {
+public:
+    struct Header {
+        std::string name;
+        std::string date;
+        std::string gameMode;
+        std::string status;
+        std::string startFen;
+        uint8_t difficulty;
+    };
+    struct Occurrence {
+        uint32_t slot;
+        uint16_t ply;
+    };
+
+    GameStore();
+    ~GameStore();
+
+    bool open(const std::string& path);
+    void close();
+    bool flush();
+    [[nodiscard]] bool isOpen() const;
+
+    bool append(const Header& header, const std::vector<Move>& moves);
+    bool remove(uint32_t slot);
+
+    [[nodiscard]] uint32_t getSize() const;
+    [[nodiscard]] const Header& getHeader(uint32_t slot) const;
+    [[nodiscard]] uint16_t getPlies(uint32_t slot) const;
+    bool load(uint32_t slot, std::vector<Move>& moves);
+    std::vector<Occurrence> find(ZobristHash hash);
+
+    static constexpr uint32_t MAGIC = 0x5347'4D51;
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint16_t MAX_PLIES = UINT16_MAX;
+    static constexpr uint64_t MIN_MERGE = 4096;
+private:
+    enum RECORD : uint8_t {
+        GAME = 1,
+        REMOVAL = 2
+    };
+
+    struct Entry {
+        Header header;
+        uint64_t movesOffset;
+        uint16_t plies;
+        bool removed;
+    };
+    struct IndexEntry {
+        uint64_t hash;
+        uint32_t id;
+        uint16_t ply;
+
+        friend bool operator <(const IndexEntry& left, const IndexEntry& right) {
+            if (left.hash != right.hash) {
+                return left.hash < right.hash;
+            }
+            return (left.id < right.id or (left.id == right.id and left.ply < right.ply));
+        }
+    };
+
+    bool readRecord(uint64_t end);
+    bool parseRecord(uint8_t kind, uint32_t payload, uint64_t next);
+    bool buildIndex();
+    void indexGame(uint32_t id, const std::vector<uint64_t>& hashes);
+    void markRemoved(uint32_t id);
+    [[nodiscard]] uint32_t getSlot(uint32_t id) const;
+
+    template<typename T> void write(T value);
+    template<typename T> bool read(T& value);
+    void writeString(const std::string& value);
+    bool readString(std::string& value);
+
+    std::fstream file;
+    uint64_t end;
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> live;
+
+    std::vector<IndexEntry> index;
+    uint64_t sorted;
+    bool indexed;
+};
\ No newline at end of file
@@ -1,228 +1,441 @@
-#include "LegalMoveGen.h"
-
-MoveList LegalMoveGen::generate(const Position& position, uint8_t side, bool onlyCaptures) {
-    MoveList moves;
-
-    Bitboard pawnsLeftCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(position.getPieces(), side, false);
-    Bitboard pawnsRightCaptures = PsLegalMoveMaskGen::generatePawnsRightCapturesMask(position.getPieces(), side, false);
-
-    int8_t pawnsLeftCaptureIndex;
-    int8_t pawnsRightCaptureIndex;
-
-    if (side == SIDE::WHITE) {
-        pawnsLeftCaptureIndex = -7;
-        pawnsRightCaptureIndex = -9;
-    }
-    else {
-        pawnsLeftCaptureIndex = 9;
-        pawnsRightCaptureIndex = 7;
-    }
-    pawnsMaskToMoves(position.getPieces(), pawnsLeftCaptures, side, pawnsLeftCaptureIndex, true, Move::FLAG::DEFAULT, moves);
-    pawnsMaskToMoves(position.getPieces(), pawnsRightCaptures, side, pawnsRightCaptureIndex, true, Move::FLAG::DEFAULT, moves);
-
-    if (!onlyCaptures) {
-        Bitboard pawnsDefault = PsLegalMoveMaskGen::generatePawnsDefaultMask(position.getPieces(), side);
-        Bitboard pawnsLong = PsLegalMoveMaskGen::generatePawnsLongMask(position.getPieces(), side);
-
-        int8_t pawnDefaultIndex;
-        int8_t pawnLongIndex;
-        if (side == SIDE::WHITE) {
-            pawnDefaultIndex = -8;
-            pawnLongIndex = -16;
-        }
-        else {
-            pawnDefaultIndex = 8;
-            pawnLongIndex = 16;
-        }
-        pawnsMaskToMoves(position.getPieces(), pawnsDefault, side, pawnDefaultIndex, false, Move::FLAG::DEFAULT, moves);
-        pawnsMaskToMoves(position.getPieces(), pawnsLong, side, pawnLongIndex, false, Move::FLAG::PAWN_LONG_MOVE, moves);
-    }
-
-    Bitboard allKnights = position.getPieces().getPieceBitboard(side, PIECE::KNIGHT);
-    Bitboard allBishops = position.getPieces().getPieceBitboard(side, PIECE::BISHOP);
-    Bitboard allRooks = position.getPieces().getPieceBitboard(side, PIECE::ROOK);
-    Bitboard allQueens = position.getPieces().getPieceBitboard(side, PIECE::QUEEN);
-    uint8_t attackerP;
-    Bitboard mask;
-    while (allKnights) {
-        attackerP = BOp::bsf(allKnights);
-        allKnights = BOp::set0(allKnights, attackerP);
-        mask = PsLegalMoveMaskGen::generateKnightMask(position.getPieces(), attackerP, side, onlyCaptures);
-        pieceMaskToMoves(position.getPieces(), mask, attackerP, PIECE::KNIGHT, side, moves);
-    }
-    while (allBishops) {
-        attackerP = BOp::bsf(allBishops);
-        allBishops = BOp::set0(allBishops, attackerP);
-        mask = PsLegalMoveMaskGen::generateBishopMask(position.getPieces(), attackerP, side, onlyCaptures);
-        pieceMaskToMoves(position.getPieces(), mask, attackerP, PIECE::BISHOP, side, moves);
-    }
-    while (allRooks) {
-        attackerP = BOp::bsf(allRooks);
-        allRooks = BOp::set0(allRooks, attackerP);
-        mask = PsLegalMoveMaskGen::generateRookMask(position.getPieces(), attackerP, side, onlyCaptures);
-        pieceMaskToMoves(position.getPieces(), mask, attackerP, PIECE::ROOK, side, moves);
-    }
-    while (allQueens) {
-        attackerP = BOp::bsf(allQueens);
-        allQueens = BOp::set0(allQueens, attackerP);
-        mask = PsLegalMoveMaskGen::generateQueenMask(position.getPieces(), attackerP, side, onlyCaptures);
-        pieceMaskToMoves(position.getPieces(), mask, attackerP, PIECE::QUEEN, side, moves);
-    }
-    attackerP = BOp::bsf(position.getPieces().getPieceBitboard(side, PIECE::KING));
-    mask = PsLegalMoveMaskGen::generateKingMask(position.getPieces(), attackerP, side, onlyCaptures);
-    pieceMaskToMoves(position.getPieces(), mask, attackerP, PIECE::KING, side, moves);
-
-    addEnPassantCaptures(position.getPieces(), side, position.getEnPassant(), moves);
-    if (!onlyCaptures) {
-        if (side == SIDE::WHITE) {
-            addCastlingMoves(position.getPieces(), SIDE::WHITE, position.getWLCastling(), position.getWSCastling(), moves);
-        }
-        else {
-            addCastlingMoves(position.getPieces(), SIDE::BLACK, position.getBLCastling(), position.getBSCastling(), moves);
-        }
-    }
-
-    return moves;
-}
-void LegalMoveGen::pieceMaskToMoves(Pieces pieces, Bitboard mask, uint8_t attackerP, uint8_t attackerType, uint8_t attackerSide, MoveList& moves) {
-    while (mask) {
-        uint8_t defenderP = BOp::bsf(mask);
-        mask = BOp::set0(mask, defenderP);
-
-        uint8_t defenderType = Move::NONE;
-        for (uint8_t i = 0; i < 6; i = i + 1) {
-            if (BOp::getBit(pieces.getPieceBitboard(Pieces::inverse(attackerSide), i), defenderP)) {
-                defenderType = i;
-                break;
-            }
-        }
-
-        Move move = { attackerP, defenderP, attackerType, attackerSide, defenderType, Pieces::inverse(attackerSide) };
-
-        if (isLegal(pieces, move)) {
-            moves.push(move);
-        }
-    }
-}
-void LegalMoveGen::pawnsMaskToMoves(Pieces pieces, Bitboard mask, uint8_t attackerSide, int8_t attackerIndex, bool checkDefender, uint8_t flag, MoveList& moves) {
-    uint8_t defenderType = Move::NONE;
-
-    while (mask) {
-        uint8_t defenderP = BOp::bsf(mask);
-        mask = BOp::set0(mask, defenderP);
-
-        if (checkDefender) {
-            defenderType = Move::NONE;
-            for (uint8_t i = 0; i < 6; i = i + 1) {
-                if (BOp::getBit(pieces.getPieceBitboard(Pieces::inverse(attackerSide), i), defenderP)) {
-                    defenderType = i;
-                    break;
-                }
-            }
-        }
-
-        Move move = { (uint8_t)(defenderP + attackerIndex), defenderP, PIECE::PAWN, attackerSide, defenderType, Pieces::inverse(attackerSide), flag };
-
-        if (isLegal(pieces, move)) {
-            if (defenderP < 8 or defenderP > 55) {
-                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, attackerSide, defenderType,Pieces::inverse(attackerSide), Move::FLAG::PROMOTE_TO_KNIGHT });
-                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, attackerSide, defenderType,Pieces::inverse(attackerSide), Move::FLAG::PROMOTE_TO_BISHOP });
-                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, attackerSide, defenderType,Pieces::inverse(attackerSide), Move::FLAG::PROMOTE_TO_ROOK });
-                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, attackerSide, defenderType,Pieces::inverse(attackerSide), Move::FLAG::PROMOTE_TO_QUEEN });
-            }
-            else {
-                moves.push(move);
-            }
-        }
-    }
-}
-bool LegalMoveGen::isLegal(Pieces pieces, Move move) {
-    pieces.setPieceBitboard(move.getAttackerSide(), move.getAttackerType(), BOp::set0(pieces.getPieceBitboard(move.getAttackerSide(), move.getAttackerType()), move.getFrom()));
-    pieces.setPieceBitboard(move.getAttackerSide(), move.getAttackerType(), BOp::set1(pieces.getPieceBitboard(move.getAttackerSide(), move.getAttackerType()), move.getTo()));
-    if (move.getDefenderType() != Move::NONE) {
-        pieces.setPieceBitboard(move.getDefenderSide(), move.getDefenderType(), BOp::set0(pieces.getPieceBitboard(move.getDefenderSide(), move.getDefenderType()), move.getTo()));
-    }
-    if (move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE) {
-        if (move.getAttackerSide() == SIDE::WHITE) {
-            pieces.setPieceBitboard(SIDE::BLACK, PIECE::PAWN, BOp::set0(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN), move.getTo() - 8));
-        }
-        else {
-            pieces.setPieceBitboard(SIDE::WHITE, PIECE::PAWN, BOp::set0(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN), move.getTo() + 8));
-        }
-    }
-
-    pieces.updateBitboards();
-
-    return !PsLegalMoveMaskGen::inDanger(pieces, BOp::bsf(pieces.getPieceBitboard(move.getAttackerSide(), PIECE::KING)), move.getAttackerSide());
-}
-void LegalMoveGen::addEnPassantCaptures(Pieces pieces, uint8_t side, uint8_t enPassant, MoveList& moves) {
-    if (enPassant == Position::NONE) {
-        return;
-    }
-
-    if (side == SIDE::WHITE) {
-        if (enPassant % 8 != 7 and BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN), enPassant - 7)) {
-            auto move = Move((uint8_t)(enPassant - 7), enPassant, PIECE::PAWN, SIDE::WHITE, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
-            if (isLegal(pieces, move)) {
-                moves.push(move);
-            }
-        }
-        if (enPassant % 8 != 0 and BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN), enPassant - 9)) {
-            auto move = Move((uint8_t)(enPassant - 9), enPassant, PIECE::PAWN, SIDE::WHITE, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
-            if (isLegal(pieces, move)) {
-                moves.push(move);
-            }
-        }
-    }
-    else {
-        if (enPassant % 8 != 0 and BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN), enPassant + 7)) {
-            auto move = Move((uint8_t)(enPassant + 7), enPassant, PIECE::PAWN, SIDE::BLACK, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
-            if (isLegal(pieces, move)) {
-                moves.push(move);
-            }
-        }
-        if (enPassant % 8 != 7 and BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN), enPassant + 9)) {
-            auto move = Move((uint8_t)(enPassant + 9), enPassant, PIECE::PAWN, SIDE::BLACK, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
-            if (isLegal(pieces, move)) {
-                moves.push(move);
-            }
-        }
-    }
-}
-void LegalMoveGen::addCastlingMoves(Pieces pieces, uint8_t side, bool lCastling, bool sCastling, MoveList& moves) {
-    uint8_t index;
-    uint8_t longCastlingFlag;
-    uint8_t shortCastlingFlag;
-    if (side == SIDE::WHITE) {
-        index = 0;
-        longCastlingFlag = Move::FLAG::WL_CASTLING;
-        shortCastlingFlag = Move::FLAG::WS_CASTLING;
-    }
-    else {
-        index = 56;
-        longCastlingFlag = Move::FLAG::BL_CASTLING;
-        shortCastlingFlag = Move::FLAG::BS_CASTLING;
-    }
-
-    if (lCastling and
-        BOp::getBit(pieces.getPieceBitboard(side, PIECE::ROOK), 0 + index) and
-        BOp::getBit(pieces.getEmptyBitboard(), 1 + index) and
-        BOp::getBit(pieces.getEmptyBitboard(), 2 + index) and
-        BOp::getBit(pieces.getEmptyBitboard(), 3 + index) and
-        !PsLegalMoveMaskGen::inDanger(pieces, BOp::bsf(pieces.getPieceBitboard(side, PIECE::KING)), side) and
-        !PsLegalMoveMaskGen::inDanger(pieces, 2 + index, side) and
-        !PsLegalMoveMaskGen::inDanger(pieces, 3 + index, side)) {
-
-        moves.push({ (uint8_t)(4 + index), (uint8_t)(2 + index), PIECE::KING, side, Move::NONE, Move::NONE, longCastlingFlag });
-    }
-    if (sCastling and
-        BOp::getBit(pieces.getPieceBitboard(side, PIECE::ROOK), 7 + index) and
-        BOp::getBit(pieces.getEmptyBitboard(), 5 + index) and
-        BOp::getBit(pieces.getEmptyBitboard(), 6 + index) and
-        !PsLegalMoveMaskGen::inDanger(pieces, BOp::bsf(pieces.getPieceBitboard(side, PIECE::KING)), side) and
-        !PsLegalMoveMaskGen::inDanger(pieces, 5 + index, side) and
-        !PsLegalMoveMaskGen::inDanger(pieces, 6 + index, side)) {
-
-        moves.push({ (uint8_t)(4 + index), (uint8_t)(6 + index), PIECE::KING, side, Move::NONE, Move::NONE, shortCastlingFlag });
-    }
-}
\ No newline at end of file
+#include "LegalMoveGen.h"
+
+MoveList LegalMoveGen::generate(const Position& position, uint8_t side, uint8_t type) {
+    if (side == SIDE::WHITE) {
+        switch (type) {
+        case GEN::CAPTURES:
+            return generate<SIDE::WHITE, GEN::CAPTURES>(position);
+        case GEN::QUIETS:
+            return generate<SIDE::WHITE, GEN::QUIETS>(position);
+        case GEN::EVASIONS:
+            return generate<SIDE::WHITE, GEN::EVASIONS>(position);
+        case GEN::QUIET_CHECKS:
+            return generate<SIDE::WHITE, GEN::QUIET_CHECKS>(position);
+        default:
+            return generate<SIDE::WHITE, GEN::ALL>(position);
+        }
+    }
+    switch (type) {
+    case GEN::CAPTURES:
+        return generate<SIDE::BLACK, GEN::CAPTURES>(position);
+    case GEN::QUIETS:
+        return generate<SIDE::BLACK, GEN::QUIETS>(position);
+    case GEN::EVASIONS:
+        return generate<SIDE::BLACK, GEN::EVASIONS>(position);
+    case GEN::QUIET_CHECKS:
+        return generate<SIDE::BLACK, GEN::QUIET_CHECKS>(position);
+    default:
+        return generate<SIDE::BLACK, GEN::ALL>(position);
+    }
+}
+template<uint8_t side, uint8_t type>
+MoveList LegalMoveGen::generate(const Position& position) {
+    if constexpr (type == GEN::EVASIONS) {
+        return generateEvasions<side>(position);
+    }
+    else if constexpr (type == GEN::QUIET_CHECKS) {
+        return generateQuietChecks<side>(position);
+    }
+    else {
+        constexpr bool captures = (type != GEN::QUIETS);
+        constexpr bool quiets = (type != GEN::CAPTURES);
+
+        constexpr int8_t pawnsLeftCaptureIndex = (side == SIDE::WHITE) ? -7 : 9;
+        constexpr int8_t pawnsRightCaptureIndex = (side == SIDE::WHITE) ? -9 : 7;
+        constexpr int8_t pawnDefaultIndex = (side == SIDE::WHITE) ? -8 : 8;
+        constexpr int8_t pawnLongIndex = (side == SIDE::WHITE) ? -16 : 16;
+        constexpr Bitboard promotionRow = BRows::ROWS[(side == SIDE::WHITE) ? 7 : 0];
+
+        const Pieces& pieces = position.getPieces();
+        MoveList moves;
+
+        Bitboard targets;
+        if constexpr (type == GEN::CAPTURES) {
+            targets = pieces.getSideBitboard(Pieces::inverse(side));
+        }
+        else if constexpr (type == GEN::QUIETS) {
+            targets = pieces.getEmptyBitboard();
+        }
+        else {
+            targets = pieces.getInvSideBitboard(side);
+        }
+
+        if constexpr (captures) {
+            Bitboard pawnsLeftCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask<side>(pieces, false);
+            Bitboard pawnsRightCaptures = PsLegalMoveMaskGen::generatePawnsRightCapturesMask<side>(pieces, false);
+            pawnsMaskToMoves<side>(pieces, pawnsLeftCaptures, pawnsLeftCaptureIndex, true, Move::FLAG::DEFAULT, moves);
+            pawnsMaskToMoves<side>(pieces, pawnsRightCaptures, pawnsRightCaptureIndex, true, Move::FLAG::DEFAULT, moves);
+        }
+
+        Bitboard pawnsDefault = PsLegalMoveMaskGen::generatePawnsDefaultMask<side>(pieces);
+        if constexpr (type == GEN::CAPTURES) {
+            pawnsDefault = pawnsDefault & promotionRow;
+        }
+        else if constexpr (type == GEN::QUIETS) {
+            pawnsDefault = pawnsDefault & ~promotionRow;
+        }
+        pawnsMaskToMoves<side>(pieces, pawnsDefault, pawnDefaultIndex, false, Move::FLAG::DEFAULT, moves);
+        if constexpr (quiets) {
+            Bitboard pawnsLong = PsLegalMoveMaskGen::generatePawnsLongMask<side>(pieces);
+            pawnsMaskToMoves<side>(pieces, pawnsLong, pawnLongIndex, false, Move::FLAG::PAWN_LONG_MOVE, moves);
+        }
+
+        Bitboard allKnights = pieces.getPieceBitboard(side, PIECE::KNIGHT);
+        Bitboard allBishops = pieces.getPieceBitboard(side, PIECE::BISHOP);
+        Bitboard allRooks = pieces.getPieceBitboard(side, PIECE::ROOK);
+        Bitboard allQueens = pieces.getPieceBitboard(side, PIECE::QUEEN);
+        uint8_t attackerP;
+        Bitboard mask;
+        while (allKnights) {
+            attackerP = BOp::bsf(allKnights);
+            allKnights = BOp::set0(allKnights, attackerP);
+            mask = PsLegalMoveMaskGen::generateKnightMask(pieces, attackerP, side, !quiets) & targets;
+            pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::KNIGHT, moves);
+        }
+        while (allBishops) {
+            attackerP = BOp::bsf(allBishops);
+            allBishops = BOp::set0(allBishops, attackerP);
+            mask = PsLegalMoveMaskGen::generateBishopMask(pieces, attackerP, side, !quiets) & targets;
+            pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::BISHOP, moves);
+        }
+        while (allRooks) {
+            attackerP = BOp::bsf(allRooks);
+            allRooks = BOp::set0(allRooks, attackerP);
+            mask = PsLegalMoveMaskGen::generateRookMask(pieces, attackerP, side, !quiets) & targets;
+            pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::ROOK, moves);
+        }
+        while (allQueens) {
+            attackerP = BOp::bsf(allQueens);
+            allQueens = BOp::set0(allQueens, attackerP);
+            mask = PsLegalMoveMaskGen::generateQueenMask(pieces, attackerP, side, !quiets) & targets;
+            pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::QUEEN, moves);
+        }
+        attackerP = BOp::bsf(pieces.getPieceBitboard(side, PIECE::KING));
+        mask = PsLegalMoveMaskGen::generateKingMask(pieces, attackerP, side, !quiets) & targets;
+        pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::KING, moves);
+
+        if constexpr (captures) {
+            addEnPassantCaptures<side>(pieces, position.getEnPassant(), moves);
+        }
+        if constexpr (quiets) {
+            if (!position.inCheck()) {
+                if constexpr (side == SIDE::WHITE) {
+                    addCastlingMoves<side>(pieces, position.getWLCastling(), position.getWSCastling(), moves);
+                }
+                else {
+                    addCastlingMoves<side>(pieces, position.getBLCastling(), position.getBSCastling(), moves);
+                }
+            }
+        }
+
+        return moves;
+    }
+}
+template<uint8_t side>
+MoveList LegalMoveGen::generateEvasions(const Position& position) {
+    constexpr int8_t pawnsLeftCaptureIndex = (side == SIDE::WHITE) ? -7 : 9;
+    constexpr int8_t pawnsRightCaptureIndex = (side == SIDE::WHITE) ? -9 : 7;
+    constexpr int8_t pawnDefaultIndex = (side == SIDE::WHITE) ? -8 : 8;
+    constexpr int8_t pawnLongIndex = (side == SIDE::WHITE) ? -16 : 16;
+
+    const Pieces& pieces = position.getPieces();
+    MoveList moves;
+
+    uint8_t kingP = BOp::bsf(pieces.getPieceBitboard(side, PIECE::KING));
+    Bitboard mask = PsLegalMoveMaskGen::generateKingMask(pieces, kingP, side, false);
+    pieceMaskToMoves<side>(pieces, mask, kingP, PIECE::KING, moves);
+
+    Bitboard checkers = position.getCheckers();
+    if (BOp::count1(checkers) > 1) {
+        return moves;
+    }
+
+    Bitboard blocks = BetweenMasks::MASKS[kingP][BOp::bsf(checkers)];
+    Bitboard targets = blocks | checkers;
+
+    Bitboard pawnsLeftCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask<side>(pieces, false) & checkers;
+    Bitboard pawnsRightCaptures = PsLegalMoveMaskGen::generatePawnsRightCapturesMask<side>(pieces, false) & checkers;
+    Bitboard pawnsDefault = PsLegalMoveMaskGen::generatePawnsDefaultMask<side>(pieces) & blocks;
+    Bitboard pawnsLong = PsLegalMoveMaskGen::generatePawnsLongMask<side>(pieces) & blocks;
+    pawnsMaskToMoves<side>(pieces, pawnsLeftCaptures, pawnsLeftCaptureIndex, true, Move::FLAG::DEFAULT, moves);
+    pawnsMaskToMoves<side>(pieces, pawnsRightCaptures, pawnsRightCaptureIndex, true, Move::FLAG::DEFAULT, moves);
+    pawnsMaskToMoves<side>(pieces, pawnsDefault, pawnDefaultIndex, false, Move::FLAG::DEFAULT, moves);
+    pawnsMaskToMoves<side>(pieces, pawnsLong, pawnLongIndex, false, Move::FLAG::PAWN_LONG_MOVE, moves);
+
+    Bitboard allKnights = pieces.getPieceBitboard(side, PIECE::KNIGHT);
+    Bitboard allBishops = pieces.getPieceBitboard(side, PIECE::BISHOP);
+    Bitboard allRooks = pieces.getPieceBitboard(side, PIECE::ROOK);
+    Bitboard allQueens = pieces.getPieceBitboard(side, PIECE::QUEEN);
+    uint8_t attackerP;
+    while (allKnights) {
+        attackerP = BOp::bsf(allKnights);
+        allKnights = BOp::set0(allKnights, attackerP);
+        mask = PsLegalMoveMaskGen::generateKnightMask(pieces, attackerP, side) & targets;
+        pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::KNIGHT, moves);
+    }
+    while (allBishops) {
+        attackerP = BOp::bsf(allBishops);
+        allBishops = BOp::set0(allBishops, attackerP);
+        mask = PsLegalMoveMaskGen::generateBishopMask(pieces, attackerP, side) & targets;
+        pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::BISHOP, moves);
+    }
+    while (allRooks) {
+        attackerP = BOp::bsf(allRooks);
+        allRooks = BOp::set0(allRooks, attackerP);
+        mask = PsLegalMoveMaskGen::generateRookMask(pieces, attackerP, side) & targets;
+        pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::ROOK, moves);
+    }
+    while (allQueens) {
+        attackerP = BOp::bsf(allQueens);
+        allQueens = BOp::set0(allQueens, attackerP);
+        mask = PsLegalMoveMaskGen::generateQueenMask(pieces, attackerP, side) & targets;
+        pieceMaskToMoves<side>(pieces, mask, attackerP, PIECE::QUEEN, moves);
+    }
+
+    addEnPassantCaptures<side>(pieces, position.getEnPassant(), moves);
+
+    return moves;
+}
+template<uint8_t side>
+MoveList LegalMoveGen::generateQuietChecks(const Position& position) {
+    constexpr int8_t pawnDefaultIndex = (side == SIDE::WHITE) ? -8 : 8;
+    constexpr int8_t pawnLongIndex = (side == SIDE::WHITE) ? -16 : 16;
+    constexpr Bitboard promotionRow = BRows::ROWS[(side == SIDE::WHITE) ? 7 : 0];
+
+    const Pieces& pieces = position.getPieces();
+    uint8_t kingP = BOp::bsf(pieces.getPieceBitboard(Pieces::inverse(side), PIECE::KING));
+    Bitboard empty = pieces.getEmptyBitboard();
+    Bitboard own = pieces.getSideBitboard(side);
+
+    Bitboard diagonalChecks = SlidersMasks::bishopAttacks(kingP, pieces.getAllBitboard());
+    Bitboard lineChecks = SlidersMasks::rookAttacks(kingP, pieces.getAllBitboard());
+
+    Bitboard discoverers = 0;
+    Bitboard queens = pieces.getPieceBitboard(side, PIECE::QUEEN);
+    Bitboard sliders = (SlidersMasks::bishopAttacks(kingP, 0) & (pieces.getPieceBitboard(side, PIECE::BISHOP) | queens)) |
+        (SlidersMasks::rookAttacks(kingP, 0) & (pieces.getPieceBitboard(side, PIECE::ROOK) | queens));
+    while (sliders) {
+        uint8_t sliderP = BOp::bsf(sliders);
+        sliders = BOp::set0(sliders, sliderP);
+        Bitboard blockers = BetweenMasks::MASKS[kingP][sliderP] & pieces.getAllBitboard();
+        if (BOp::count1(blockers) == 1) {
+            discoverers = discoverers | (blockers & own);
+        }
+    }
+
+    MoveList candidates;
+
+    Bitboard pawns = pieces.getPieceBitboard(side, PIECE::PAWN) & discoverers;
+    Bitboard pawnChecks = PawnMasks::ATTACK_MASKS[Pieces::inverse(side)][kingP];
+    if constexpr (side == SIDE::WHITE) {
+        pawnChecks = pawnChecks | (pawns << 8) | (pawns << 16);
+    }
+    else {
+        pawnChecks = pawnChecks | (pawns >> 8) | (pawns >> 16);
+    }
+    Bitboard pawnsDefault = PsLegalMoveMaskGen::generatePawnsDefaultMask<side>(pieces) & ~promotionRow & pawnChecks;
+    Bitboard pawnsLong = PsLegalMoveMaskGen::generatePawnsLongMask<side>(pieces) & pawnChecks;
+    pawnsMaskToMoves<side>(pieces, pawnsDefault, pawnDefaultIndex, false, Move::FLAG::DEFAULT, candidates);
+    pawnsMaskToMoves<side>(pieces, pawnsLong, pawnLongIndex, false, Move::FLAG::PAWN_LONG_MOVE, candidates);
+
+    std::array<Bitboard, 6> checks{};
+    checks[PIECE::KNIGHT] = KnightMasks::MASKS[kingP];
+    checks[PIECE::BISHOP] = diagonalChecks;
+    checks[PIECE::ROOK] = lineChecks;
+    checks[PIECE::QUEEN] = diagonalChecks | lineChecks;
+
+    for (uint8_t type = PIECE::KNIGHT; type <= PIECE::KING; type = type + 1) {
+        Bitboard all = pieces.getPieceBitboard(side, type);
+        while (all) {
+            uint8_t attackerP = BOp::bsf(all);
+            all = BOp::set0(all, attackerP);
+
+            Bitboard targets = BOp::getBit(discoverers, attackerP) ? empty : (checks[type] & empty);
+            if (targets == 0) {
+                continue;
+            }
+
+            Bitboard mask;
+            switch (type) {
+            case PIECE::KNIGHT:
+                mask = PsLegalMoveMaskGen::generateKnightMask(pieces, attackerP, side);
+                break;
+            case PIECE::BISHOP:
+                mask = PsLegalMoveMaskGen::generateBishopMask(pieces, attackerP, side);
+                break;
+            case PIECE::ROOK:
+                mask = PsLegalMoveMaskGen::generateRookMask(pieces, attackerP, side);
+                break;
+            case PIECE::QUEEN:
+                mask = PsLegalMoveMaskGen::generateQueenMask(pieces, attackerP, side);
+                break;
+            default:
+                mask = PsLegalMoveMaskGen::generateKingMask(pieces, attackerP, side);
+                break;
+            }
+            pieceMaskToMoves<side>(pieces, mask & targets, attackerP, type, candidates);
+        }
+    }
+
+    MoveList moves;
+    for (uint8_t i = 0; i < candidates.getSize(); i = i + 1) {
+        if (givesCheck(pieces, candidates[i])) {
+            moves.push(candidates[i]);
+        }
+    }
+
+    return moves;
+}
+template<uint8_t side>
+void LegalMoveGen::pieceMaskToMoves(const Pieces& pieces, Bitboard mask, uint8_t attackerP, uint8_t attackerType, MoveList& moves) {
+    while (mask) {
+        uint8_t defenderP = BOp::bsf(mask);
+        mask = BOp::set0(mask, defenderP);
+
+        uint8_t defenderType = pieces.getPieceType(defenderP);
+
+        Move move = { attackerP, defenderP, attackerType, side, defenderType, Pieces::inverse(side) };
+
+        if (isLegal(pieces, move)) {
+            moves.push(move);
+        }
+    }
+}
+template<uint8_t side>
+void LegalMoveGen::pawnsMaskToMoves(const Pieces& pieces, Bitboard mask, int8_t attackerIndex, bool checkDefender, uint8_t flag, MoveList& moves) {
+    constexpr Bitboard promotionRow = BRows::ROWS[(side == SIDE::WHITE) ? 7 : 0];
+
+    uint8_t defenderType = Move::NONE;
+
+    while (mask) {
+        uint8_t defenderP = BOp::bsf(mask);
+        mask = BOp::set0(mask, defenderP);
+
+        if (checkDefender) {
+            defenderType = pieces.getPieceType(defenderP);
+        }
+
+        Move move = { (uint8_t)(defenderP + attackerIndex), defenderP, PIECE::PAWN, side, defenderType, Pieces::inverse(side), flag };
+
+        if (isLegal(pieces, move)) {
+            if (BOp::getBit(promotionRow, defenderP)) {
+                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, side, defenderType, Pieces::inverse(side), Move::FLAG::PROMOTE_TO_KNIGHT });
+                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, side, defenderType, Pieces::inverse(side), Move::FLAG::PROMOTE_TO_BISHOP });
+                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, side, defenderType, Pieces::inverse(side), Move::FLAG::PROMOTE_TO_ROOK });
+                moves.push({ (uint8_t)(defenderP + attackerIndex), defenderP, 0, side, defenderType, Pieces::inverse(side), Move::FLAG::PROMOTE_TO_QUEEN });
+            }
+            else {
+                moves.push(move);
+            }
+        }
+    }
+}
+bool LegalMoveGen::isLegal(const Pieces& pieces, Move move) {
+    uint8_t capturedP = move.getTo();
+    Bitboard occupancy = BOp::set0(pieces.getAllBitboard(), move.getFrom());
+    if (move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE) {
+        if (move.getAttackerSide() == SIDE::WHITE) {
+            capturedP = move.getTo() - 8;
+        }
+        else {
+            capturedP = move.getTo() + 8;
+        }
+        occupancy = BOp::set0(occupancy, capturedP);
+    }
+    occupancy = BOp::set1(occupancy, move.getTo());
+
+    uint8_t kingP;
+    if (move.getAttackerType() == PIECE::KING) {
+        kingP = move.getTo();
+    }
+    else {
+        kingP = BOp::bsf(pieces.getPieceBitboard(move.getAttackerSide(), PIECE::KING));
+    }
+
+    Bitboard attackers = pieces.attackersTo(kingP, occupancy) & pieces.getSideBitboard(Pieces::inverse(move.getAttackerSide()));
+    return (BOp::set0(attackers, capturedP) == 0);
+}
+bool LegalMoveGen::givesCheck(const Pieces& pieces, Move move) {
+    uint8_t defenderSide = Pieces::inverse(move.getAttackerSide());
+    uint8_t kingP = BOp::bsf(pieces.getPieceBitboard(defenderSide, PIECE::KING));
+    Bitboard occupancy = BOp::set1(BOp::set0(pieces.getAllBitboard(), move.getFrom()), move.getTo());
+
+    Bitboard discovered = pieces.attackersTo(kingP, occupancy) & pieces.getSideBitboard(move.getAttackerSide());
+    if (BOp::set0(discovered, move.getFrom())) {
+        return true;
+    }
+
+    switch (move.getAttackerType()) {
+    case PIECE::PAWN:
+        return BOp::getBit(PawnMasks::ATTACK_MASKS[defenderSide][kingP], move.getTo());
+    case PIECE::KNIGHT:
+        return BOp::getBit(KnightMasks::MASKS[kingP], move.getTo());
+    case PIECE::BISHOP:
+        return BOp::getBit(SlidersMasks::bishopAttacks(kingP, occupancy), move.getTo());
+    case PIECE::ROOK:
+        return BOp::getBit(SlidersMasks::rookAttacks(kingP, occupancy), move.getTo());
+    case PIECE::QUEEN:
+        return BOp::getBit(SlidersMasks::bishopAttacks(kingP, occupancy) | SlidersMasks::rookAttacks(kingP, occupancy), move.getTo());
+    default:
+        return false;
+    }
+}
+template<uint8_t side>
+void LegalMoveGen::addEnPassantCaptures(const Pieces& pieces, uint8_t enPassant, MoveList& moves) {
+    constexpr int8_t leftIndex = (side == SIDE::WHITE) ? -7 : 9;
+    constexpr int8_t rightIndex = (side == SIDE::WHITE) ? -9 : 7;
+
+    if (enPassant == Position::NONE) {
+        return;
+    }
+
+    Bitboard pawns = pieces.getPieceBitboard(side, PIECE::PAWN);
+    if (enPassant % 8 != 7 and BOp::getBit(pawns, enPassant + leftIndex)) {
+        auto move = Move((uint8_t)(enPassant + leftIndex), enPassant, PIECE::PAWN, side, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
+        if (isLegal(pieces, move)) {
+            moves.push(move);
+        }
+    }
+    if (enPassant % 8 != 0 and BOp::getBit(pawns, enPassant + rightIndex)) {
+        auto move = Move((uint8_t)(enPassant + rightIndex), enPassant, PIECE::PAWN, side, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE);
+        if (isLegal(pieces, move)) {
+            moves.push(move);
+        }
+    }
+}
+template<uint8_t side>
+void LegalMoveGen::addCastlingMoves(const Pieces& pieces, bool lCastling, bool sCastling, MoveList& moves) {
+    constexpr uint8_t index = (side == SIDE::WHITE) ? 0 : 56;
+    constexpr uint8_t longCastlingFlag = (side == SIDE::WHITE) ? Move::FLAG::WL_CASTLING : Move::FLAG::BL_CASTLING;
+    constexpr uint8_t shortCastlingFlag = (side == SIDE::WHITE) ? Move::FLAG::WS_CASTLING : Move::FLAG::BS_CASTLING;
+
+    if (lCastling and
+        BOp::getBit(pieces.getPieceBitboard(side, PIECE::ROOK), 0 + index) and
+        BOp::getBit(pieces.getEmptyBitboard(), 1 + index) and
+        BOp::getBit(pieces.getEmptyBitboard(), 2 + index) and
+        BOp::getBit(pieces.getEmptyBitboard(), 3 + index) and
+        !PsLegalMoveMaskGen::inDanger(pieces, 2 + index, side) and
+        !PsLegalMoveMaskGen::inDanger(pieces, 3 + index, side)) {
+
+        moves.push({ (uint8_t)(4 + index), (uint8_t)(2 + index), PIECE::KING, side, Move::NONE, Move::NONE, longCastlingFlag });
+    }
+    if (sCastling and
+        BOp::getBit(pieces.getPieceBitboard(side, PIECE::ROOK), 7 + index) and
+        BOp::getBit(pieces.getEmptyBitboard(), 5 + index) and
+        BOp::getBit(pieces.getEmptyBitboard(), 6 + index) and
+        !PsLegalMoveMaskGen::inDanger(pieces, 5 + index, side) and
+        !PsLegalMoveMaskGen::inDanger(pieces, 6 + index, side)) {
+
+        moves.push({ (uint8_t)(4 + index), (uint8_t)(6 + index), PIECE::KING, side, Move::NONE, Move::NONE, shortCastlingFlag });
+    }
+}
+template MoveList LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::ALL>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::CAPTURES>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::QUIETS>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::EVASIONS>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::WHITE, LegalMoveGen::GEN::QUIET_CHECKS>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::ALL>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::CAPTURES>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::QUIETS>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::EVASIONS>(const Position& position);
+template MoveList LegalMoveGen::generate<SIDE::BLACK, LegalMoveGen::GEN::QUIET_CHECKS>(const Position& position);
\ No newline at end of file
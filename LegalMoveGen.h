@@ -1,19 +1,41 @@
-#include "MoveList.h"
-#include "PsLegalMoveMaskGen.h"
-
-
-#pragma once
-
-
-class LegalMoveGen {
-public:
-    static MoveList generate(const Position& position, uint8_t side, bool onlyCaptures = false);
-private:
-    static void pieceMaskToMoves(Pieces pieces, Bitboard mask, uint8_t attackerP, uint8_t attackerType, uint8_t attackerSide, MoveList& moves);
-    static void pawnsMaskToMoves(Pieces pieces, Bitboard mask, uint8_t attackerSide, int8_t attackerIndex, bool checkDefender, uint8_t flag, MoveList& moves);
-
-    static bool isLegal(Pieces pieces, Move move);
-
-    static void addEnPassantCaptures(Pieces pieces, uint8_t side, uint8_t enPassant, MoveList& moves);
-    static void addCastlingMoves(Pieces pieces, uint8_t side, bool lCastling, bool sCastling, MoveList& moves);
+#include "MoveList.h"
+#include "PsLegalMoveMaskGen.h"
+
+
+#pragma once
+
+
+class LegalMoveGen {
+public:
+    enum GEN {
+        ALL,
+        CAPTURES,
+        QUIETS,
+        EVASIONS,
+        QUIET_CHECKS
+    };
+
+    static MoveList generate(const Position& position, uint8_t side, uint8_t type = GEN::ALL);
+    template<uint8_t side, uint8_t type>
+    static MoveList generate(const Position& position);
+private:
+    template<uint8_t side>
+    static MoveList generateEvasions(const Position& position);
+    template<uint8_t side>
+    static MoveList generateQuietChecks(const Position& position);
+
+    template<uint8_t side>
+    static void pieceMaskToMoves(const Pieces& pieces, Bitboard mask, uint8_t attackerP, uint8_t attackerType, MoveList& moves);
+    template<uint8_t side>
+    static void pawnsMaskToMoves(const Pieces& pieces, Bitboard mask, int8_t attackerIndex, bool checkDefender, uint8_t flag, MoveList& moves);
+
+    static bool isLegal(const Pieces& pieces, Move move);
+    static bool givesCheck(const Pieces& pieces, Move move);
+
+    template<uint8_t side>
+    static void addEnPassantCaptures(const Pieces& pieces, uint8_t enPassant, MoveList& moves);
+    template<uint8_t side>
+    static void addCastlingMoves(const Pieces& pieces, bool lCastling, bool sCastling, MoveList& moves);
+
+    friend class Notation;
 };
\ No newline at end of file
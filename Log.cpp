@@ -0,0 +1,32 @@
+#include "Log.h"
+
+
+Log* Log::log = nullptr;
+
+
+Log* Log::getPtr() {
+    if (log == nullptr) {
+        log = new Log();
+    }
+    return log;
+}
+void Log::setLevel(uint8_t newLevel) {
+    this->level = newLevel;
+}
+void Log::setStream(std::ostream& newStream) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stream = &newStream;
+}
+bool Log::enabled(uint8_t messageLevel) const {
+    return (messageLevel <= this->level.load(std::memory_order_relaxed));
+}
+void Log::write(uint8_t messageLevel, const std::string& message) {
+    static constexpr std::array<const char*, 5> NAMES = { "", "WARNING", "INFO", "DEBUG", "TRACE" };
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    *this->stream << "[" << NAMES[messageLevel] << "] " << message << std::endl;
+}
+Log::Log() {
+    this->level = LEVEL::WARNING;
+    this->stream = &std::cout;
+}
@@ -0,0 +1,54 @@
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+
+#pragma once
+
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL Log::LEVEL::INFO
+#endif
+
+
+#define LOG(level, message)                                      \
+    do {                                                         \
+        if constexpr ((level) <= (LOG_LEVEL)) {                  \
+            if (Log::getPtr()->enabled(level)) {                 \
+                std::ostringstream logStream;                    \
+                logStream << message;                            \
+                Log::getPtr()->write(level, logStream.str());    \
+            }                                                    \
+        }                                                        \
+    } while (false)
+
+
+class Log {
+public:
+    static Log* getPtr();
+    Log(const Log& donor) = delete;
+
+    enum LEVEL {
+        SILENT,
+        WARNING,
+        INFO,
+        DEBUG,
+        TRACE
+    };
+
+    void setLevel(uint8_t newLevel);
+    void setStream(std::ostream& newStream);
+    [[nodiscard]] bool enabled(uint8_t messageLevel) const;
+    void write(uint8_t messageLevel, const std::string& message);
+private:
+    Log();
+
+    static Log* log;
+
+    std::atomic<uint8_t> level;
+    std::ostream* stream;
+    std::mutex mutex;
+};
@@ -1,13 +1,13 @@
-#include "MoveList.h"
-#include "StaticEvaluator.h"
-
-
-#pragma once
-
-
-class MoveSorter {
-public:
-    static MoveList sort(Pieces pieces, MoveList moves);
-private:
-    static int32_t evaluateMove(Pieces pieces, Move move);
+#include "MoveList.h"
+#include "StaticEvaluator.h"
+
+
+#pragma once
+
+
+class MoveSorter {
+public:
+    static void sort(const Pieces& pieces, MoveList& moves);
+private:
+    static int32_t evaluateMove(const Pieces& pieces, Move move);
 };
\ No newline at end of file
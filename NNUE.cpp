@@ -0,0 +1,208 @@
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+#include "NNUE.h"
+
+
+NNUE* NNUE::nnue = nullptr;
+
+
+NNUE* NNUE::getPtr() {
+    if (nnue == nullptr) {
+        nnue = new NNUE();
+    }
+    return nnue;
+}
+bool NNUE::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::array<uint32_t, 4> header{};
+    file.read(reinterpret_cast<char*>(header.data()), sizeof(header));
+    if (!file or header[0] != MAGIC or header[1] != VERSION or header[2] != KING_BUCKETS or header[3] != HIDDEN) {
+        return false;
+    }
+
+    auto loadedNetwork = std::make_unique<Network>();
+    file.read(reinterpret_cast<char*>(loadedNetwork->featureWeights.data()), sizeof(loadedNetwork->featureWeights));
+    file.read(reinterpret_cast<char*>(loadedNetwork->featureBiases.data()), sizeof(loadedNetwork->featureBiases));
+    file.read(reinterpret_cast<char*>(loadedNetwork->outputWeights.data()), sizeof(loadedNetwork->outputWeights));
+    file.read(reinterpret_cast<char*>(&loadedNetwork->outputBias), sizeof(loadedNetwork->outputBias));
+    if (!file) {
+        return false;
+    }
+
+    this->network = std::move(loadedNetwork);
+    if (this->accumulators == nullptr) {
+        this->accumulators = std::make_unique<std::array<Accumulator, MAX_PLY>>();
+    }
+    return true;
+}
+void NNUE::setEnabled(bool enabled) {
+    this->use = enabled;
+}
+bool NNUE::loaded() const {
+    return (this->network != nullptr);
+}
+bool NNUE::enabled() const {
+    return (this->use and this->loaded());
+}
+void NNUE::refresh(const Position& position, uint32_t ply) {
+    Accumulator& accumulator = (*this->accumulators)[ply];
+    this->refreshPerspective(accumulator, position.getPieces(), SIDE::WHITE);
+    this->refreshPerspective(accumulator, position.getPieces(), SIDE::BLACK);
+}
+void NNUE::update(const Position& position, uint32_t ply) {
+    const Accumulator& parent = (*this->accumulators)[ply - 1];
+    Accumulator& accumulator = (*this->accumulators)[ply];
+    const Pieces& pieces = position.getPieces();
+
+    for (uint8_t perspective = 0; perspective < 2; perspective = perspective + 1) {
+        uint8_t bucket = kingBucket(BOp::bsf(pieces.getPieceBitboard(perspective, PIECE::KING)), perspective);
+        if (bucket != parent.kingBuckets[perspective]) {
+            this->refreshPerspective(accumulator, pieces, perspective);
+            continue;
+        }
+
+        accumulator.values[perspective] = parent.values[perspective];
+        accumulator.kingBuckets[perspective] = bucket;
+        for (uint8_t i = 0; i < position.getDirtyPiecesNumber(); i = i + 1) {
+            Position::DirtyPiece dirtyPiece = position.getDirtyPiece(i);
+            uint32_t index = featureIndex(bucket, perspective, dirtyPiece.square, dirtyPiece.type, dirtyPiece.side);
+            if (dirtyPiece.added) {
+                addRow(accumulator.values[perspective], this->network->featureWeights[index]);
+            }
+            else {
+                subtractRow(accumulator.values[perspective], this->network->featureWeights[index]);
+            }
+        }
+    }
+}
+int32_t NNUE::evaluate(const Position& position, uint32_t ply) const {
+    const Accumulator& accumulator = (*this->accumulators)[ply];
+
+    uint8_t us = position.whiteToMove() ? SIDE::WHITE : SIDE::BLACK;
+    uint8_t them = Pieces::inverse(us);
+
+    int64_t output = clippedDot(accumulator.values[us], this->network->outputWeights[0]);
+    output = output + clippedDot(accumulator.values[them], this->network->outputWeights[1]);
+    output = output + this->network->outputBias;
+
+    auto evaluation = (int32_t)(output * SCALE / (QA * QB));
+    if (us == SIDE::BLACK) {
+        evaluation = -evaluation;
+    }
+    return evaluation;
+}
+uint8_t NNUE::kingBucket(uint8_t kingP, uint8_t perspective) {
+    if (perspective == SIDE::BLACK) {
+        kingP = kingP ^ 56;
+    }
+    return (kingP % 8 >= 4) + 2 * (kingP / 8 >= 2);
+}
+uint32_t NNUE::featureIndex(uint8_t kingBucket, uint8_t perspective, uint8_t square, uint8_t type, uint8_t side) {
+    if (perspective == SIDE::BLACK) {
+        square = square ^ 56;
+    }
+    uint32_t relativeSide = (side != perspective);
+    return ((kingBucket * 2 + relativeSide) * 6 + type) * 64 + square;
+}
+void NNUE::refreshPerspective(Accumulator& accumulator, const Pieces& pieces, uint8_t perspective) const {
+    uint8_t bucket = kingBucket(BOp::bsf(pieces.getPieceBitboard(perspective, PIECE::KING)), perspective);
+
+    accumulator.values[perspective] = this->network->featureBiases;
+    accumulator.kingBuckets[perspective] = bucket;
+
+    for (uint8_t side = 0; side < 2; side = side + 1) {
+        for (uint8_t type = 0; type < 6; type = type + 1) {
+            Bitboard bb = pieces.getPieceBitboard(side, type);
+            while (bb) {
+                uint8_t square = BOp::bsf(bb);
+                bb = BOp::set0(bb, square);
+                addRow(accumulator.values[perspective], this->network->featureWeights[featureIndex(bucket, perspective, square, type, side)]);
+            }
+        }
+    }
+}
+void NNUE::addRow(std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& row) {
+#if defined(__AVX2__)
+    for (uint32_t i = 0; i < HIDDEN; i = i + 16) {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(&values[i]));
+        __m256i r = _mm256_load_si256(reinterpret_cast<const __m256i*>(&row[i]));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&values[i]), _mm256_add_epi16(v, r));
+    }
+#elif defined(__SSE4_1__)
+    for (uint32_t i = 0; i < HIDDEN; i = i + 8) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&values[i]));
+        __m128i r = _mm_load_si128(reinterpret_cast<const __m128i*>(&row[i]));
+        _mm_store_si128(reinterpret_cast<__m128i*>(&values[i]), _mm_add_epi16(v, r));
+    }
+#else
+    for (uint32_t i = 0; i < HIDDEN; i = i + 1) {
+        values[i] = (int16_t)(values[i] + row[i]);
+    }
+#endif
+}
+void NNUE::subtractRow(std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& row) {
+#if defined(__AVX2__)
+    for (uint32_t i = 0; i < HIDDEN; i = i + 16) {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(&values[i]));
+        __m256i r = _mm256_load_si256(reinterpret_cast<const __m256i*>(&row[i]));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&values[i]), _mm256_sub_epi16(v, r));
+    }
+#elif defined(__SSE4_1__)
+    for (uint32_t i = 0; i < HIDDEN; i = i + 8) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&values[i]));
+        __m128i r = _mm_load_si128(reinterpret_cast<const __m128i*>(&row[i]));
+        _mm_store_si128(reinterpret_cast<__m128i*>(&values[i]), _mm_sub_epi16(v, r));
+    }
+#else
+    for (uint32_t i = 0; i < HIDDEN; i = i + 1) {
+        values[i] = (int16_t)(values[i] - row[i]);
+    }
+#endif
+}
+int32_t NNUE::clippedDot(const std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& weights) {
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i qa = _mm256_set1_epi16(QA);
+    __m256i sum = _mm256_setzero_si256();
+    for (uint32_t i = 0; i < HIDDEN; i = i + 16) {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(&values[i]));
+        __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(&weights[i]));
+        v = _mm256_min_epi16(_mm256_max_epi16(v, zero), qa);
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(v, w));
+    }
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    return _mm_cvtsi128_si32(half);
+#elif defined(__SSE4_1__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i qa = _mm_set1_epi16(QA);
+    __m128i sum = _mm_setzero_si128();
+    for (uint32_t i = 0; i < HIDDEN; i = i + 8) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&values[i]));
+        __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(&weights[i]));
+        v = _mm_min_epi16(_mm_max_epi16(v, zero), qa);
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(v, w));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return _mm_cvtsi128_si32(sum);
+#else
+    int32_t sum = 0;
+    for (uint32_t i = 0; i < HIDDEN; i = i + 1) {
+        int32_t v = std::clamp((int32_t)values[i], 0, QA);
+        sum = sum + v * weights[i];
+    }
+    return sum;
+#endif
+}
+NNUE::NNUE() {
+    this->use = false;
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "Position.h"
+
+
+#pragma once
+
+
+class NNUE {
+public:
+    static NNUE* getPtr();
+    NNUE(const NNUE& donor) = delete;
+
+    bool load(const std::string& path);
+    void setEnabled(bool enabled);
+    [[nodiscard]] bool loaded() const;
+    [[nodiscard]] bool enabled() const;
+
+    void refresh(const Position& position, uint32_t ply);
+    void update(const Position& position, uint32_t ply);
+    [[nodiscard]] int32_t evaluate(const Position& position, uint32_t ply) const;
+
+    static constexpr uint32_t KING_BUCKETS = 4;
+    static constexpr uint32_t INPUTS = KING_BUCKETS * 2 * 6 * 64;
+    static constexpr uint32_t HIDDEN = 256;
+    static constexpr int32_t MAX_PLY = 256;
+
+    static constexpr int32_t QA = 255;
+    static constexpr int32_t QB = 64;
+    static constexpr int32_t SCALE = 400;
+
+    static constexpr uint32_t MAGIC = 0x4555'4E4E;
+    static constexpr uint32_t VERSION = 1;
+private:
+    NNUE();
+
+    struct Accumulator {
+        alignas(32) std::array<std::array<int16_t, HIDDEN>, 2> values;
+        std::array<uint8_t, 2> kingBuckets;
+    };
+    struct Network {
+        alignas(32) std::array<std::array<int16_t, HIDDEN>, INPUTS> featureWeights;
+        alignas(32) std::array<int16_t, HIDDEN> featureBiases;
+        alignas(32) std::array<std::array<int16_t, HIDDEN>, 2> outputWeights;
+        int32_t outputBias;
+    };
+
+    static uint8_t kingBucket(uint8_t kingP, uint8_t perspective);
+    static uint32_t featureIndex(uint8_t kingBucket, uint8_t perspective, uint8_t square, uint8_t type, uint8_t side);
+
+    void refreshPerspective(Accumulator& accumulator, const Pieces& pieces, uint8_t perspective) const;
+
+    static void addRow(std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& row);
+    static void subtractRow(std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& row);
+    static int32_t clippedDot(const std::array<int16_t, HIDDEN>& values, const std::array<int16_t, HIDDEN>& weights);
+
+    static NNUE* nnue;
+
+    std::unique_ptr<Network> network;
+    std::unique_ptr<std::array<Accumulator, MAX_PLY>> accumulators;
+    bool use;
+};
@@ -0,0 +1,473 @@
+#include "Notation.h"
+
+
+bool Notation::parseFen(std::string_view fen, Position& position) {
+    std::array<std::string_view, 6> fields{};
+    uint8_t count = 0;
+    size_t begin = fen.find_first_not_of(' ');
+    while (begin != std::string_view::npos and count < fields.size()) {
+        size_t end = std::min(fen.find(' ', begin), fen.size());
+        fields[count] = fen.substr(begin, end - begin);
+        count = count + 1;
+        begin = fen.find_first_not_of(' ', end);
+    }
+    if (count < 2) {
+        return false;
+    }
+
+    uint8_t x = 0;
+    uint8_t y = 7;
+    std::array<uint8_t, 2> kings = { 0, 0 };
+    for (char symbol : fields[0]) {
+        if (symbol == '/') {
+            if (x != 8 or y == 0) {
+                return false;
+            }
+            x = 0;
+            y = y - 1;
+        }
+        else if (symbol >= '1' and symbol <= '8') {
+            x = x + symbol - '0';
+            if (x > 8) {
+                return false;
+            }
+        }
+        else {
+            size_t piece = PIECE_SYMBOLS.find(symbol);
+            if (piece == std::string_view::npos or x == 8) {
+                return false;
+            }
+            if (piece % 6 == PIECE::PAWN and (y == 0 or y == 7)) {
+                return false;
+            }
+            if (piece % 6 == PIECE::KING) {
+                kings[piece / 6] = kings[piece / 6] + 1;
+            }
+            x = x + 1;
+        }
+    }
+    if (x != 8 or y != 0 or kings[SIDE::WHITE] != 1 or kings[SIDE::BLACK] != 1) {
+        return false;
+    }
+
+    uint8_t side;
+    if (fields[1] == "w") {
+        side = SIDE::WHITE;
+    }
+    else if (fields[1] == "b") {
+        side = SIDE::BLACK;
+    }
+    else {
+        return false;
+    }
+
+    Pieces pieces{ std::string(fields[0]) };
+    uint8_t opponentKing = BOp::bsf(pieces.getPieceBitboard(Pieces::inverse(side), PIECE::KING));
+    if (PsLegalMoveMaskGen::inDanger(pieces, opponentKing, Pieces::inverse(side))) {
+        return false;
+    }
+
+    std::array<bool, 4> castling = { false, false, false, false };
+    if (count > 2 and fields[2] != "-") {
+        for (char symbol : fields[2]) {
+            size_t right = std::string_view("QKqk").find(symbol);
+            if (right == std::string_view::npos) {
+                return false;
+            }
+            castling[right] = true;
+        }
+    }
+    for (uint8_t right = 0; right < 4; right = right + 1) {
+        uint8_t rightSide = right / 2;
+        uint8_t index = (rightSide == SIDE::WHITE) ? 0 : 56;
+        uint8_t rookSquare = index + ((right % 2 == 0) ? 0 : 7);
+        if (!BOp::getBit(pieces.getPieceBitboard(rightSide, PIECE::KING), index + 4) or !BOp::getBit(pieces.getPieceBitboard(rightSide, PIECE::ROOK), rookSquare)) {
+            castling[right] = false;
+        }
+    }
+
+    uint8_t enPassant = Position::NONE;
+    if (count > 3 and fields[3] != "-") {
+        enPassant = parseSquare(fields[3]);
+        if (enPassant == Position::NONE or enPassant / 8 != ((side == SIDE::WHITE) ? 5 : 2)) {
+            return false;
+        }
+    }
+
+    uint32_t halfmoveClock = 0;
+    uint32_t fullmoveNumber = 1;
+    if (count > 4 and parseNumber(fields[4], halfmoveClock) and count > 5) {
+        parseNumber(fields[5], fullmoveNumber);
+    }
+
+    position = Position(std::string(fields[0]), enPassant, castling[0], castling[1], castling[2], castling[3], side, (uint8_t)std::min(halfmoveClock, 255u), (uint16_t)std::clamp(fullmoveNumber, 1u, 65535u));
+    return true;
+}
+std::string Notation::writeFen(const Position& position) {
+    const Pieces& pieces = position.getPieces();
+
+    std::string fen;
+    fen.reserve(90);
+
+    for (int8_t y = 7; y >= 0; y = y - 1) {
+        uint8_t empty = 0;
+        for (uint8_t x = 0; x < 8; x = x + 1) {
+            uint8_t square = y * 8 + x;
+            if (pieces.getPieceType(square) == Pieces::NONE) {
+                empty = empty + 1;
+                continue;
+            }
+            if (empty != 0) {
+                fen += (char)('0' + empty);
+                empty = 0;
+            }
+            fen += PIECE_SYMBOLS[pieces.getPieceSide(square) * 6 + pieces.getPieceType(square)];
+        }
+        if (empty != 0) {
+            fen += (char)('0' + empty);
+        }
+        if (y != 0) {
+            fen += '/';
+        }
+    }
+
+    fen += position.whiteToMove() ? " w " : " b ";
+
+    size_t castlingBegin = fen.size();
+    if (position.getWSCastling()) {
+        fen += 'K';
+    }
+    if (position.getWLCastling()) {
+        fen += 'Q';
+    }
+    if (position.getBSCastling()) {
+        fen += 'k';
+    }
+    if (position.getBLCastling()) {
+        fen += 'q';
+    }
+    if (fen.size() == castlingBegin) {
+        fen += '-';
+    }
+
+    fen += ' ';
+    if (position.getEnPassant() == Position::NONE) {
+        fen += '-';
+    }
+    else {
+        writeSquare(fen, position.getEnPassant());
+    }
+
+    fen += ' ';
+    fen += std::to_string(position.getHalfmoveClock());
+    fen += ' ';
+    fen += std::to_string(position.getFullmoveNumber());
+
+    return fen;
+}
+Move Notation::parseUci(const Position& position, std::string_view uci) {
+    if (uci.size() != 4 and uci.size() != 5) {
+        return {};
+    }
+
+    uint8_t from = parseSquare(uci.substr(0, 2));
+    uint8_t to = parseSquare(uci.substr(2, 2));
+    uint8_t promotion = Move::FLAG::DEFAULT;
+    if (uci.size() == 5) {
+        promotion = promotionFlag((char)std::toupper((unsigned char)uci[4]));
+        if (promotion == Move::FLAG::DEFAULT) {
+            return {};
+        }
+    }
+    if (from == Position::NONE or to == Position::NONE) {
+        return {};
+    }
+
+    return findMove(position, from, to, promotion);
+}
+std::string Notation::writeUci(Move move) {
+    std::string uci;
+    if (move.getFrom() == Move::NONE) {
+        uci = "0000";
+        return uci;
+    }
+
+    writeSquare(uci, move.getFrom());
+    writeSquare(uci, move.getTo());
+    if (move.getFlag() >= Move::FLAG::PROMOTE_TO_KNIGHT) {
+        uci += (char)std::tolower((unsigned char)PROMOTION_SYMBOLS[move.getFlag() - Move::FLAG::PROMOTE_TO_KNIGHT]);
+    }
+    return uci;
+}
+Move Notation::parseSan(const Position& position, std::string_view san) {
+    while (!san.empty() and std::string_view("+#!?").find(san.back()) != std::string_view::npos) {
+        san.remove_suffix(1);
+    }
+
+    if (san == "O-O" or san == "0-0" or san == "O-O-O" or san == "0-0-0") {
+        bool longCastling = (san.size() == 5);
+        uint8_t kingP = (position.getSide() == SIDE::WHITE) ? 4 : 60;
+        return findMove(position, kingP, longCastling ? kingP - 2 : kingP + 2, Move::FLAG::DEFAULT);
+    }
+
+    uint8_t promotion = Move::FLAG::DEFAULT;
+    if (san.size() > 2 and san[san.size() - 2] == '=') {
+        promotion = promotionFlag((char)std::toupper((unsigned char)san.back()));
+        if (promotion == Move::FLAG::DEFAULT) {
+            return {};
+        }
+        san.remove_suffix(2);
+    }
+    else if (san.size() > 2 and PROMOTION_SYMBOLS.find(san.back()) != std::string_view::npos and std::isdigit((unsigned char)san[san.size() - 2])) {
+        promotion = promotionFlag(san.back());
+        san.remove_suffix(1);
+    }
+
+    uint8_t type = PIECE::PAWN;
+    if (!san.empty()) {
+        size_t piece = PIECE_SYMBOLS.substr(PIECE::KNIGHT, 5).find(san.front());
+        if (piece != std::string_view::npos) {
+            type = PIECE::KNIGHT + piece;
+            san.remove_prefix(1);
+        }
+    }
+    if (san.size() < 2) {
+        return {};
+    }
+
+    uint8_t to = parseSquare(san.substr(san.size() - 2));
+    if (to == Position::NONE) {
+        return {};
+    }
+
+    int8_t fromFile = -1;
+    int8_t fromRank = -1;
+    for (char symbol : san.substr(0, san.size() - 2)) {
+        if (symbol >= 'a' and symbol <= 'h') {
+            fromFile = (int8_t)(symbol - 'a');
+        }
+        else if (symbol >= '1' and symbol <= '8') {
+            fromRank = (int8_t)(symbol - '1');
+        }
+        else if (symbol != 'x' and symbol != '-' and symbol != ':') {
+            return {};
+        }
+    }
+    if (type == PIECE::PAWN and fromFile == -1) {
+        fromFile = (int8_t)(to % 8);
+    }
+
+    Move found;
+    Bitboard candidates = position.getPieces().getPieceBitboard(position.getSide(), type);
+    while (candidates) {
+        uint8_t from = BOp::bsf(candidates);
+        candidates = BOp::set0(candidates, from);
+
+        if ((fromFile != -1 and from % 8 != fromFile) or (fromRank != -1 and from / 8 != fromRank)) {
+            continue;
+        }
+
+        Move move = findMove(position, from, to, promotion);
+        if (move.getFrom() == Move::NONE or isCastling(move)) {
+            continue;
+        }
+        if (found.getFrom() != Move::NONE) {
+            return {};
+        }
+        found = move;
+    }
+    return found;
+}
+std::string Notation::writeSan(const Position& position, Move move) {
+    std::string san;
+
+    if (move.getFlag() == Move::FLAG::WL_CASTLING or move.getFlag() == Move::FLAG::BL_CASTLING) {
+        san = "O-O-O";
+    }
+    else if (move.getFlag() == Move::FLAG::WS_CASTLING or move.getFlag() == Move::FLAG::BS_CASTLING) {
+        san = "O-O";
+    }
+    else {
+        bool capture = (move.getDefenderType() != Move::NONE or move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE);
+
+        if (move.getAttackerType() == PIECE::PAWN) {
+            if (capture) {
+                san += (char)('a' + move.getFrom() % 8);
+            }
+        }
+        else {
+            san += PIECE_SYMBOLS[move.getAttackerType()];
+
+            bool ambiguous = false;
+            bool sameFile = false;
+            bool sameRank = false;
+            Bitboard others = BOp::set0(position.getPieces().getPieceBitboard(position.getSide(), move.getAttackerType()), move.getFrom());
+            while (others) {
+                uint8_t other = BOp::bsf(others);
+                others = BOp::set0(others, other);
+                if (findMove(position, other, move.getTo(), Move::FLAG::DEFAULT).getFrom() == Move::NONE) {
+                    continue;
+                }
+                ambiguous = true;
+                sameFile = (sameFile or other % 8 == move.getFrom() % 8);
+                sameRank = (sameRank or other / 8 == move.getFrom() / 8);
+            }
+            if (ambiguous) {
+                if (!sameFile) {
+                    san += (char)('a' + move.getFrom() % 8);
+                }
+                else if (!sameRank) {
+                    san += (char)('1' + move.getFrom() / 8);
+                }
+                else {
+                    writeSquare(san, move.getFrom());
+                }
+            }
+        }
+
+        if (capture) {
+            san += 'x';
+        }
+        writeSquare(san, move.getTo());
+
+        if (move.getFlag() >= Move::FLAG::PROMOTE_TO_KNIGHT) {
+            san += '=';
+            san += PROMOTION_SYMBOLS[move.getFlag() - Move::FLAG::PROMOTE_TO_KNIGHT];
+        }
+    }
+
+    Position next = position;
+    next.move(move);
+    if (next.inCheck()) {
+        san += (LegalMoveGen::generate(next, next.getSide()).getSize() == 0) ? '#' : '+';
+    }
+    return san;
+}
+Move Notation::findMove(const Position& position, uint8_t from, uint8_t to, uint8_t promotion) {
+    const Pieces& pieces = position.getPieces();
+    uint8_t side = position.getSide();
+
+    uint8_t type = pieces.getPieceType(from);
+    if (type == Pieces::NONE or pieces.getPieceSide(from) != side or from == to) {
+        return {};
+    }
+    uint8_t defenderType = pieces.getPieceType(to);
+    if (defenderType != Pieces::NONE and (pieces.getPieceSide(to) == side or defenderType == PIECE::KING)) {
+        return {};
+    }
+
+    if (type == PIECE::KING and (from + 2 == to or to + 2 == from)) {
+        MoveList moves = LegalMoveGen::generate(position, side, LegalMoveGen::GEN::QUIETS);
+        for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+            if (isCastling(moves[i]) and moves[i].getFrom() == from and moves[i].getTo() == to) {
+                return moves[i];
+            }
+        }
+        return {};
+    }
+
+    Move move;
+    if (type == PIECE::PAWN) {
+        int8_t forward = (side == SIDE::WHITE) ? 8 : -8;
+        uint8_t flag = Move::FLAG::DEFAULT;
+        bool promotionRank = (to / 8 == ((side == SIDE::WHITE) ? 7 : 0));
+        if (promotionRank != (promotion != Move::FLAG::DEFAULT)) {
+            return {};
+        }
+
+        if (BOp::getBit(PawnMasks::ATTACK_MASKS[side][from], to)) {
+            if (defenderType == Pieces::NONE) {
+                if (to != position.getEnPassant()) {
+                    return {};
+                }
+                move = { from, to, PIECE::PAWN, side, Move::NONE, Move::NONE, Move::FLAG::EN_PASSANT_CAPTURE };
+                return LegalMoveGen::isLegal(pieces, move) ? move : Move();
+            }
+        }
+        else if (to == from + forward) {
+            if (defenderType != Pieces::NONE) {
+                return {};
+            }
+        }
+        else if (to == from + 2 * forward and from / 8 == ((side == SIDE::WHITE) ? 1 : 6)) {
+            if (defenderType != Pieces::NONE or pieces.getPieceType(from + forward) != Pieces::NONE) {
+                return {};
+            }
+            flag = Move::FLAG::PAWN_LONG_MOVE;
+        }
+        else {
+            return {};
+        }
+
+        if (promotionRank) {
+            flag = promotion;
+        }
+        move = { from, to, PIECE::PAWN, side, defenderType, Pieces::inverse(side), flag };
+    }
+    else {
+        if (promotion != Move::FLAG::DEFAULT) {
+            return {};
+        }
+
+        Bitboard reachable;
+        switch (type) {
+        case PIECE::KNIGHT:
+            reachable = KnightMasks::MASKS[from];
+            break;
+        case PIECE::BISHOP:
+            reachable = SlidersMasks::bishopAttacks(from, pieces.getAllBitboard());
+            break;
+        case PIECE::ROOK:
+            reachable = SlidersMasks::rookAttacks(from, pieces.getAllBitboard());
+            break;
+        case PIECE::QUEEN:
+            reachable = SlidersMasks::bishopAttacks(from, pieces.getAllBitboard()) | SlidersMasks::rookAttacks(from, pieces.getAllBitboard());
+            break;
+        default:
+            reachable = KingMasks::MASKS[from];
+            break;
+        }
+        if (!BOp::getBit(reachable, to)) {
+            return {};
+        }
+        move = { from, to, type, side, defenderType, Pieces::inverse(side) };
+    }
+
+    return LegalMoveGen::isLegal(pieces, move) ? move : Move();
+}
+uint8_t Notation::parseSquare(std::string_view square) {
+    if (square.size() != 2 or square[0] < 'a' or square[0] > 'h' or square[1] < '1' or square[1] > '8') {
+        return Position::NONE;
+    }
+    return (square[1] - '1') * 8 + (square[0] - 'a');
+}
+void Notation::writeSquare(std::string& out, uint8_t square) {
+    out += (char)('a' + square % 8);
+    out += (char)('1' + square / 8);
+}
+uint8_t Notation::promotionFlag(char symbol) {
+    switch (symbol) {
+    case 'N':
+        return Move::FLAG::PROMOTE_TO_KNIGHT;
+    case 'B':
+        return Move::FLAG::PROMOTE_TO_BISHOP;
+    case 'R':
+        return Move::FLAG::PROMOTE_TO_ROOK;
+    case 'Q':
+        return Move::FLAG::PROMOTE_TO_QUEEN;
+    default:
+        return Move::FLAG::DEFAULT;
+    }
+}
+bool Notation::isCastling(Move move) {
+    return (move.getFlag() >= Move::FLAG::WL_CASTLING and move.getFlag() <= Move::FLAG::BS_CASTLING);
+}
+bool Notation::parseNumber(std::string_view field, uint32_t& number) {
+    uint32_t value;
+    auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (error != std::errc() or end != field.data() + field.size()) {
+        return false;
+    }
+    number = value;
+    return true;
+}
\ No newline at end of file
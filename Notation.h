@@ -0,0 +1,34 @@
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include "LegalMoveGen.h"
+
+
+#pragma once
+
+
+class Notation {
+public:
+    static bool parseFen(std::string_view fen, Position& position);
+    static std::string writeFen(const Position& position);
+
+    static Move parseUci(const Position& position, std::string_view uci);
+    static std::string writeUci(Move move);
+
+    static Move parseSan(const Position& position, std::string_view san);
+    static std::string writeSan(const Position& position, Move move);
+
+    static constexpr std::string_view START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+private:
+    static constexpr std::string_view PIECE_SYMBOLS = "PNBRQKpnbrqk";
+    static constexpr std::string_view PROMOTION_SYMBOLS = "NBRQ";
+
+    static Move findMove(const Position& position, uint8_t from, uint8_t to, uint8_t promotion);
+
+    static uint8_t parseSquare(std::string_view square);
+    static void writeSquare(std::string& out, uint8_t square);
+    static uint8_t promotionFlag(char symbol);
+    static bool isCastling(Move move);
+    static bool parseNumber(std::string_view field, uint32_t& number);
+};
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include <array>
+#include "Bitboard.h"
+
+
+#pragma once
+
+
+namespace PawnMasks {
+    static consteval std::array<Bitboard, 64> calcWhiteAttackMasks() {
+        std::array<Bitboard, 64> masks{};
+
+        for (uint8_t x = 0; x < 8; x = x + 1) {
+            for (uint8_t y = 0; y < 7; y = y + 1) {
+                if (x != 0) {
+                    masks[y * 8 + x] = BOp::set1(masks[y * 8 + x], (y + 1) * 8 + x - 1);
+                }
+                if (x != 7) {
+                    masks[y * 8 + x] = BOp::set1(masks[y * 8 + x], (y + 1) * 8 + x + 1);
+                }
+            }
+        }
+
+        return masks;
+    }
+    static consteval std::array<Bitboard, 64> calcBlackAttackMasks() {
+        std::array<Bitboard, 64> masks{};
+
+        for (uint8_t x = 0; x < 8; x = x + 1) {
+            for (uint8_t y = 1; y < 8; y = y + 1) {
+                if (x != 0) {
+                    masks[y * 8 + x] = BOp::set1(masks[y * 8 + x], (y - 1) * 8 + x - 1);
+                }
+                if (x != 7) {
+                    masks[y * 8 + x] = BOp::set1(masks[y * 8 + x], (y - 1) * 8 + x + 1);
+                }
+            }
+        }
+
+        return masks;
+    }
+    static constexpr std::array<std::array<Bitboard, 64>, 2> ATTACK_MASKS = { calcWhiteAttackMasks(), calcBlackAttackMasks() };
+}
\ No newline at end of file
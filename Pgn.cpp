@@ -0,0 +1,291 @@
+#include "Pgn.h"
+
+
+std::string Pgn::Game::getTag(std::string_view name) const {
+    for (const auto& [tagName, value] : this->tags) {
+        if (tagName == name) {
+            return value;
+        }
+    }
+    return "";
+}
+void Pgn::Game::setTag(const std::string& name, const std::string& value) {
+    for (auto& [tagName, tagValue] : this->tags) {
+        if (tagName == name) {
+            tagValue = value;
+            return;
+        }
+    }
+    this->tags.emplace_back(name, value);
+}
+Pgn::Pgn(const std::string& path) {
+    this->buffer = std::make_unique<char[]>(BUFFER_SIZE);
+    this->file.rdbuf()->pubsetbuf(this->buffer.get(), BUFFER_SIZE);
+    this->file.open(path, std::ios::binary);
+    this->offset = 0;
+    this->gameOffset = 0;
+    this->pendingOffset = 0;
+    this->pending = false;
+}
+bool Pgn::isOpen() const {
+    return this->file.is_open();
+}
+bool Pgn::read(Game& game, bool replay) {
+    game.tags.clear();
+    game.startFen = Notation::START_FEN;
+    game.moves.clear();
+    game.result.clear();
+    game.legal = true;
+
+    Position position;
+    bool started = false;
+    bool inMovetext = false;
+    bool inComment = false;
+    int32_t variationDepth = 0;
+
+    std::string line;
+    uint64_t lineOffset;
+    while (this->readLine(line, lineOffset)) {
+        if (!inComment) {
+            if (line.empty() or line[0] == '%') {
+                continue;
+            }
+            if (line[0] == '[') {
+                if (inMovetext) {
+                    this->unreadLine(line, lineOffset);
+                    break;
+                }
+                if (!started) {
+                    started = true;
+                    this->gameOffset = lineOffset;
+                }
+                std::string name;
+                std::string value;
+                if (parseTag(line, name, value)) {
+                    game.tags.emplace_back(std::move(name), std::move(value));
+                }
+                continue;
+            }
+        }
+
+        if (!started) {
+            started = true;
+            this->gameOffset = lineOffset;
+        }
+        if (!inMovetext) {
+            inMovetext = true;
+            std::string fen = game.getTag("FEN");
+            if (!fen.empty()) {
+                game.startFen = fen;
+            }
+            game.legal = setUp(game, position);
+        }
+
+        size_t tokenBegin = 0;
+        for (size_t i = 0; i <= line.size(); i = i + 1) {
+            char c = (i < line.size()) ? line[i] : ' ';
+            if (inComment) {
+                inComment = (c != '}');
+                tokenBegin = i + 1;
+                continue;
+            }
+            if (c != ' ' and c != '\t' and c != '{' and c != ';' and c != '(' and c != ')') {
+                continue;
+            }
+
+            std::string_view token = std::string_view(line).substr(tokenBegin, std::min(i, line.size()) - tokenBegin);
+            tokenBegin = i + 1;
+            bool mainLine = (variationDepth == 0);
+            if (c == '{') {
+                inComment = true;
+            }
+            else if (c == ';') {
+                i = line.size();
+            }
+            else if (c == '(') {
+                variationDepth = variationDepth + 1;
+            }
+            else if (c == ')') {
+                variationDepth = std::max(0, variationDepth - 1);
+            }
+            if (token.empty() or !mainLine) {
+                continue;
+            }
+            if (isResult(token)) {
+                game.result = token;
+                return true;
+            }
+
+            token = stripMoveNumber(token);
+            if (token.empty() or token[0] == '$' or token[0] == '!' or token[0] == '?' or !replay or !game.legal) {
+                continue;
+            }
+            Move move = Notation::parseSan(position, token);
+            if (move.getFrom() == Move::NONE) {
+                game.legal = false;
+                continue;
+            }
+            game.moves.push_back(move);
+            position.move(move);
+        }
+    }
+
+    if (started and game.result.empty()) {
+        game.result = game.getTag("Result");
+        if (!isResult(game.result)) {
+            game.result = "*";
+        }
+    }
+    if (started and !inMovetext) {
+        std::string fen = game.getTag("FEN");
+        if (!fen.empty()) {
+            game.startFen = fen;
+        }
+        game.legal = setUp(game, position);
+    }
+    return started;
+}
+bool Pgn::seek(uint64_t offset) {
+    this->file.clear();
+    this->file.seekg((std::streamoff)offset);
+    this->offset = offset;
+    this->pending = false;
+    return (bool)this->file;
+}
+uint64_t Pgn::getGameOffset() const {
+    return this->gameOffset;
+}
+bool Pgn::write(std::ostream& out, const Game& game) {
+    Position position;
+    if (!setUp(game, position)) {
+        return false;
+    }
+
+    std::string result = isResult(game.result) ? game.result : "*";
+    for (std::string_view name : SEVEN_TAG_ROSTER) {
+        std::string value = game.getTag(name);
+        if (name == "Result") {
+            value = result;
+        }
+        else if (value.empty()) {
+            value = (name == "Date") ? "????.??.??" : "?";
+        }
+        writeTag(out, name, value);
+    }
+    bool setUpTag = (game.startFen != Notation::START_FEN);
+    if (setUpTag) {
+        writeTag(out, "SetUp", "1");
+        writeTag(out, "FEN", game.startFen);
+    }
+    for (const auto& [name, value] : game.tags) {
+        bool written = std::find(std::begin(SEVEN_TAG_ROSTER), std::end(SEVEN_TAG_ROSTER), name) != std::end(SEVEN_TAG_ROSTER);
+        written = written or (setUpTag and (name == "SetUp" or name == "FEN"));
+        if (!written) {
+            writeTag(out, name, value);
+        }
+    }
+    out << '\n';
+
+    uint32_t lineLength = 0;
+    for (size_t i = 0; i < game.moves.size(); i = i + 1) {
+        if (position.whiteToMove()) {
+            writeToken(out, std::to_string(position.getFullmoveNumber()) + ".", lineLength);
+        }
+        else if (i == 0) {
+            writeToken(out, std::to_string(position.getFullmoveNumber()) + "...", lineLength);
+        }
+        writeToken(out, Notation::writeSan(position, game.moves[i]), lineLength);
+        position.move(game.moves[i]);
+    }
+    writeToken(out, result, lineLength);
+    out << "\n\n";
+
+    return (bool)out;
+}
+bool Pgn::readLine(std::string& line, uint64_t& lineOffset) {
+    if (this->pending) {
+        this->pending = false;
+        line = std::move(this->pendingLine);
+        lineOffset = this->pendingOffset;
+        return true;
+    }
+
+    lineOffset = this->offset;
+    if (!std::getline(this->file, line)) {
+        return false;
+    }
+    this->offset = this->offset + line.size() + !this->file.eof();
+
+    if (!line.empty() and line.back() == '\r') {
+        line.pop_back();
+    }
+    return true;
+}
+void Pgn::unreadLine(std::string& line, uint64_t lineOffset) {
+    this->pendingLine = std::move(line);
+    this->pendingOffset = lineOffset;
+    this->pending = true;
+}
+bool Pgn::setUp(const Game& game, Position& position) {
+    return Notation::parseFen(game.startFen, position);
+}
+bool Pgn::parseTag(std::string_view line, std::string& name, std::string& value) {
+    size_t nameEnd = line.find_first_of(" \t\"", 1);
+    size_t valueBegin = line.find('"');
+    if (nameEnd == std::string_view::npos or valueBegin == std::string_view::npos or nameEnd == 1) {
+        return false;
+    }
+
+    name = line.substr(1, nameEnd - 1);
+    value.clear();
+    for (size_t i = valueBegin + 1; i < line.size(); i = i + 1) {
+        if (line[i] == '"') {
+            return true;
+        }
+        if (line[i] == '\\' and i + 1 < line.size()) {
+            i = i + 1;
+        }
+        value.push_back(line[i]);
+    }
+    return false;
+}
+bool Pgn::isResult(std::string_view token) {
+    return (token == "1-0" or token == "0-1" or token == "1/2-1/2" or token == "*");
+}
+std::string_view Pgn::stripMoveNumber(std::string_view token) {
+    size_t digits = token.find_first_not_of("0123456789");
+    if (digits == std::string_view::npos) {
+        return {};
+    }
+    if (digits == 0 and token[0] != '.') {
+        return token;
+    }
+    if (token[digits] != '.') {
+        return token;
+    }
+    token.remove_prefix(digits);
+    size_t dots = token.find_first_not_of('.');
+    return (dots == std::string_view::npos) ? std::string_view() : token.substr(dots);
+}
+void Pgn::writeTag(std::ostream& out, std::string_view name, std::string_view value) {
+    out << '[' << name << " \"";
+    for (char c : value) {
+        if (c == '"' or c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << "\"]\n";
+}
+void Pgn::writeToken(std::ostream& out, const std::string& token, uint32_t& lineLength) {
+    if (lineLength != 0 and lineLength + 1 + token.size() > LINE_LENGTH) {
+        out << '\n';
+        lineLength = 0;
+    }
+    if (lineLength != 0) {
+        out << ' ';
+        lineLength = lineLength + 1;
+    }
+    out << token;
+    lineLength = lineLength + token.size();
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Notation.h"
+
+
+#pragma once
+
+
+class Pgn {
+public:
+    struct Game {
+        std::vector<std::pair<std::string, std::string>> tags;
+        std::string startFen;
+        std::vector<Move> moves;
+        std::string result;
+        bool legal;
+
+        [[nodiscard]] std::string getTag(std::string_view name) const;
+        void setTag(const std::string& name, const std::string& value);
+    };
+
+    explicit Pgn(const std::string& path);
+
+    [[nodiscard]] bool isOpen() const;
+    bool read(Game& game, bool replay = true);
+    bool seek(uint64_t offset);
+    [[nodiscard]] uint64_t getGameOffset() const;
+
+    static bool write(std::ostream& out, const Game& game);
+
+    static constexpr std::string_view SEVEN_TAG_ROSTER[] = {"Event", "Site", "Date", "Round", "White", "Black", "Result"};
+    static constexpr uint32_t LINE_LENGTH = 79;
+    static constexpr uint32_t BUFFER_SIZE = 1 << 16;
+private:
+    bool readLine(std::string& line, uint64_t& lineOffset);
+    void unreadLine(std::string& line, uint64_t lineOffset);
+    static bool setUp(const Game& game, Position& position);
+
+    static bool parseTag(std::string_view line, std::string& name, std::string& value);
+    static bool isResult(std::string_view token);
+    static std::string_view stripMoveNumber(std::string_view token);
+    static void writeTag(std::ostream& out, std::string_view name, std::string_view value);
+    static void writeToken(std::ostream& out, const std::string& token, uint32_t& lineLength);
+
+    std::ifstream file;
+    std::unique_ptr<char[]> buffer;
+    uint64_t offset;
+    uint64_t gameOffset;
+
+    std::string pendingLine;
+    uint64_t pendingOffset;
+    bool pending;
+};
\ No newline at end of file
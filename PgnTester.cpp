@@ -0,0 +1,82 @@
+#include "PgnTester.h"
+
+void PgnTester::runTests() {
+    std::array<Test, 4> tests = {{
+        {
+            "[Event \"Variations\"]\n"
+            "[Result \"1-0\"]\n"
+            "\n"
+            "1. e4 e5 2. Nf3 Nc6(2... d6 3. d4) 3. Bb5 {Spanish} a6 (3... Nf6 (3... d6) 4. O-O)\n"
+            "4. Ba4 $1 Nf6 5. O-O! ; castles\n"
+            "1-0\n",
+            "e2e4 e7e5 g1f3 b8c6 f1b5 a7a6 b5a4 g8f6 e1g1",
+            "1-0",
+            true
+        },
+        {
+            "[Event \"No result token\"]\n"
+            "[Result \"1/2-1/2\"]\n"
+            "\n"
+            "1.d4 d5 2.c4 (2.Nf3) e6\n",
+            "d2d4 d7d5 c2c4 e7e6",
+            "1/2-1/2",
+            true
+        },
+        {
+            "[Event \"Set up\"]\n"
+            "[SetUp \"1\"]\n"
+            "[FEN \"4k3/8/8/8/8/8/4P3/4K3 w - - 0 1\"]\n"
+            "\n"
+            "1. e4 (1. e3 Kd7) 1... Kf7 2. e5 *\n",
+            "e2e4 e8f7 e4e5",
+            "*",
+            true
+        },
+        {
+            "[Event \"Illegal\"]\n"
+            "\n"
+            "1. e4 e5 2. Ke3 Nc6 0-1\n",
+            "e2e4 e7e5",
+            "0-1",
+            false
+        }
+    }};
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "pgn_tester.pgn";
+    {
+        std::ofstream file(path, std::ios::binary);
+        for (const auto& test : tests) {
+            file << test.text << "\n";
+        }
+    }
+
+    Pgn pgn(path.string());
+    for (const auto& test : tests) {
+        runTest(pgn, test);
+    }
+    std::cout << std::endl;
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
+void PgnTester::runTest(Pgn& pgn, const Test& test) {
+    Pgn::Game game;
+    bool read = pgn.read(game);
+
+    std::string moves;
+    for (Move move : game.moves) {
+        if (!moves.empty()) {
+            moves.push_back(' ');
+        }
+        moves = moves + Notation::writeUci(move);
+    }
+
+    std::string event = game.getTag("Event");
+    if (read and moves == test.moves and game.result == test.result and game.legal == test.legal) {
+        std::cout << "Game \"" << event << "\". Moves: " << moves << ". Result: " << game.result << ". OK." << std::endl;
+    }
+    else {
+        std::cout << "Game \"" << event << "\". Correct: " << test.moves << " " << test.result << ". Got: " << moves << " " << game.result << ". Error." << std::endl;
+        std::terminate();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#include <filesystem>
+#include <iostream>
+#include "Pgn.h"
+
+
+#pragma once
+
+
+class PgnTester {
+public:
+    static void runTests();
+private:
+    struct Test {
+        std::string text;
+        std::string moves;
+        std::string result;
+        bool legal;
+    };
+
+    static void runTest(Pgn& pgn, const Test& test);
+};
\ No newline at end of file
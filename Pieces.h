@@ -1,68 +1,79 @@
-/*
- *  Natrix
- *  Copyright (C) 2023 gth-other
- *
- *  Natrix is free software: you can redistribute it and/or modify
- *  it under the terms of the GNU General Public License as published by
- *  the Free Software Foundation, either version 3 of the License, or
- *  (at your option) any later version.
- *
- *  Natrix is distributed in the hope that it will be useful,
- *  but WITHOUT ANY WARRANTY; without even the implied warranty of
- *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- *  GNU General Public License for more details.
- *
- *  You should have received a copy of the GNU General Public License
- *  along with Natrix.  If not, see <http://www.gnu.org/licenses/>.
- */
-
-
-#include <cctype>
-#include "Bitboard.h"
-
-
-#pragma once
-
-
-enum PIECE {
-    PAWN = 0,
-    KNIGHT = 1,
-    BISHOP = 2,
-    ROOK = 3,
-    QUEEN = 4,
-    KING = 5
-};
-
-
-enum SIDE {
-    WHITE = 0,
-    BLACK = 1
-};
-
-
-class Pieces {
-public:
-    Pieces();
-    Pieces(const std::string& shortFen);
-
-    friend std::ostream& operator <<(std::ostream& ostream, Pieces pieces);
-
-    void updateBitboards();
-
-    void setPieceBitboard(uint8_t side, uint8_t piece, Bitboard bb);
-
-    [[nodiscard]] std::array<std::array<Bitboard, 6>, 2> getPieceBitboards() const;
-    [[nodiscard]] Bitboard getPieceBitboard(uint8_t side, uint8_t piece) const;
-    [[nodiscard]] Bitboard getSideBitboard(uint8_t side) const;
-    [[nodiscard]] Bitboard getInvSideBitboard(uint8_t side) const;
-    [[nodiscard]] Bitboard getAllBitboard() const;
-    [[nodiscard]] Bitboard getEmptyBitboard() const;
-
-    static uint8_t inverse(uint8_t side);
-private:
-    std::array<std::array<Bitboard, 6>, 2> pieceBitboards{};
-    std::array<Bitboard, 2> sideBitboards{};
-    std::array<Bitboard, 2> invSideBitboards{};
-    Bitboard all;
-    Bitboard empty;
+/*
+ *  Natrix
+ *  Copyright (C) 2023 gth-other
+ *
+ *  Natrix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Natrix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Natrix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <cctype>
+#include "Bitboard.h"
+#include "PawnMasks.h"
+#include "KnightMasks.h"
+#include "KingMasks.h"
+#include "SlidersMasks.h"
+
+
+#pragma once
+
+
+enum PIECE {
+    PAWN = 0,
+    KNIGHT = 1,
+    BISHOP = 2,
+    ROOK = 3,
+    QUEEN = 4,
+    KING = 5
+};
+
+
+enum SIDE {
+    WHITE = 0,
+    BLACK = 1
+};
+
+
+class Pieces {
+public:
+    Pieces();
+    Pieces(const std::string& shortFen);
+
+    friend std::ostream& operator <<(std::ostream& ostream, const Pieces& pieces);
+
+    void updateBitboards();
+
+    void addPiece(uint8_t square, uint8_t type, uint8_t side);
+    void removePiece(uint8_t square, uint8_t type, uint8_t side);
+
+    [[nodiscard]] std::array<std::array<Bitboard, 6>, 2> getPieceBitboards() const;
+    [[nodiscard]] Bitboard getPieceBitboard(uint8_t side, uint8_t piece) const;
+    [[nodiscard]] Bitboard getSideBitboard(uint8_t side) const;
+    [[nodiscard]] Bitboard getInvSideBitboard(uint8_t side) const;
+    [[nodiscard]] Bitboard getAllBitboard() const;
+    [[nodiscard]] Bitboard getEmptyBitboard() const;
+    [[nodiscard]] uint8_t getPieceType(uint8_t square) const;
+    [[nodiscard]] uint8_t getPieceSide(uint8_t square) const;
+    [[nodiscard]] Bitboard attackersTo(uint8_t square, Bitboard occupancy) const;
+
+    static uint8_t inverse(uint8_t side);
+
+    static constexpr uint8_t NONE = 255;
+private:
+    std::array<std::array<Bitboard, 6>, 2> pieceBitboards{};
+    std::array<Bitboard, 2> sideBitboards{};
+    std::array<Bitboard, 2> invSideBitboards{};
+    Bitboard all;
+    Bitboard empty;
+    std::array<uint8_t, 64> mailbox;
 };
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include "PolyglotBook.h"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+PolyglotBook* PolyglotBook::polyglotBook = nullptr;
+
+
+PolyglotBook* PolyglotBook::getPtr() {
+    if (polyglotBook == nullptr) {
+        polyglotBook = new PolyglotBook();
+    }
+    return polyglotBook;
+}
+PolyglotBook::~PolyglotBook() {
+    this->close();
+}
+bool PolyglotBook::load(const std::string& path) {
+    this->close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) or fileSize.QuadPart < ENTRY_SIZE) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    this->file = file;
+    this->mapping = mapping;
+    this->data = static_cast<const uint8_t*>(view);
+    this->size = (uint64_t)fileSize.QuadPart / ENTRY_SIZE;
+#else
+    int32_t file = open(path.c_str(), O_RDONLY);
+    if (file == -1) {
+        return false;
+    }
+    struct stat fileStat{};
+    if (fstat(file, &fileStat) == -1 or fileStat.st_size < ENTRY_SIZE) {
+        ::close(file);
+        return false;
+    }
+    void* view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (view == MAP_FAILED) {
+        ::close(file);
+        return false;
+    }
+    this->file = file;
+    this->data = static_cast<const uint8_t*>(view);
+    this->size = (uint64_t)fileStat.st_size / ENTRY_SIZE;
+#endif
+
+    return true;
+}
+void PolyglotBook::close() {
+    if (this->data == nullptr) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(this->data);
+    CloseHandle(this->mapping);
+    CloseHandle(this->file);
+    this->mapping = nullptr;
+    this->file = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(this->data), this->size * ENTRY_SIZE);
+    ::close(this->file);
+    this->file = -1;
+#endif
+
+    this->data = nullptr;
+    this->size = 0;
+}
+bool PolyglotBook::loaded() const {
+    return this->data != nullptr;
+}
+uint64_t PolyglotBook::getKey(const Position& position) const {
+    uint64_t key = 0;
+
+    const Pieces& pieces = position.getPieces();
+    for (uint8_t side = 0; side < 2; side = side + 1) {
+        for (uint8_t type = 0; type < 6; type = type + 1) {
+            uint32_t kind = 2 * type + (side == SIDE::WHITE);
+            Bitboard bb = pieces.getPieceBitboard(side, type);
+            while (bb) {
+                uint8_t square = BOp::bsf(bb);
+                bb = BOp::set0(bb, square);
+                key = key ^ PolyglotBookConstants::RANDOM[64 * kind + square];
+            }
+        }
+    }
+
+    if (position.getWSCastling()) {
+        key = key ^ PolyglotBookConstants::RANDOM[CASTLING_OFFSET + 0];
+    }
+    if (position.getWLCastling()) {
+        key = key ^ PolyglotBookConstants::RANDOM[CASTLING_OFFSET + 1];
+    }
+    if (position.getBSCastling()) {
+        key = key ^ PolyglotBookConstants::RANDOM[CASTLING_OFFSET + 2];
+    }
+    if (position.getBLCastling()) {
+        key = key ^ PolyglotBookConstants::RANDOM[CASTLING_OFFSET + 3];
+    }
+
+    uint8_t enPassant = position.getEnPassant();
+    if (enPassant != Position::NONE) {
+        uint8_t us = position.whiteToMove() ? SIDE::WHITE : SIDE::BLACK;
+        Bitboard attackers = PawnMasks::ATTACK_MASKS[Pieces::inverse(us)][enPassant] & pieces.getPieceBitboard(us, PIECE::PAWN);
+        if (attackers) {
+            key = key ^ PolyglotBookConstants::RANDOM[EN_PASSANT_OFFSET + enPassant % 8];
+        }
+    }
+
+    if (position.whiteToMove()) {
+        key = key ^ PolyglotBookConstants::RANDOM[TURN_OFFSET];
+    }
+
+    return key;
+}
+Move PolyglotBook::probe(const Position& position, uint8_t side) {
+    if (!this->loaded()) {
+        return {};
+    }
+
+    uint64_t key = this->getKey(position);
+    uint64_t first = this->lowerBound(key);
+
+    std::vector<std::pair<Move, uint32_t>> candidates;
+    uint32_t totalWeight = 0;
+    for (uint64_t i = first; i < this->size; i = i + 1) {
+        Entry entry = this->getEntry(i);
+        if (entry.key != key) {
+            break;
+        }
+        Move move = decodeMove(position, side, entry.move);
+        if (move.getFrom() == Move::NONE) {
+            continue;
+        }
+        candidates.emplace_back(move, entry.weight);
+        totalWeight = totalWeight + entry.weight;
+    }
+
+    if (candidates.empty()) {
+        return {};
+    }
+    if (totalWeight == 0) {
+        return candidates[std::uniform_int_distribution<uint64_t>(0, candidates.size() - 1)(this->random)].first;
+    }
+
+    uint32_t choice = std::uniform_int_distribution<uint32_t>(0, totalWeight - 1)(this->random);
+    for (const auto& candidate : candidates) {
+        if (choice < candidate.second) {
+            return candidate.first;
+        }
+        choice = choice - candidate.second;
+    }
+    return candidates.back().first;
+}
+uint16_t PolyglotBook::encodeMove(Move move) {
+    uint8_t from = move.getFrom();
+    uint8_t to = move.getTo();
+    uint16_t promotion = 0;
+
+    switch (move.getFlag()) {
+    case Move::FLAG::WL_CASTLING:
+        to = 0;
+        break;
+    case Move::FLAG::WS_CASTLING:
+        to = 7;
+        break;
+    case Move::FLAG::BL_CASTLING:
+        to = 56;
+        break;
+    case Move::FLAG::BS_CASTLING:
+        to = 63;
+        break;
+    case Move::FLAG::PROMOTE_TO_KNIGHT:
+        promotion = 1;
+        break;
+    case Move::FLAG::PROMOTE_TO_BISHOP:
+        promotion = 2;
+        break;
+    case Move::FLAG::PROMOTE_TO_ROOK:
+        promotion = 3;
+        break;
+    case Move::FLAG::PROMOTE_TO_QUEEN:
+        promotion = 4;
+        break;
+    }
+
+    return (uint16_t)((promotion << 12) | (from << 6) | to);
+}
+Move PolyglotBook::decodeMove(const Position& position, uint8_t side, uint16_t bookMove) {
+    MoveList moves = LegalMoveGen::generate(position, side);
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        if (encodeMove(moves[i]) == bookMove) {
+            return moves[i];
+        }
+    }
+    return {};
+}
+PolyglotBook::Entry PolyglotBook::getEntry(uint64_t index) const {
+    const uint8_t* entry = this->data + index * ENTRY_SIZE;
+    return {readBigEndian(entry, 8), (uint16_t)readBigEndian(entry + 8, 2), (uint16_t)readBigEndian(entry + 10, 2), (uint32_t)readBigEndian(entry + 12, 4)};
+}
+uint64_t PolyglotBook::lowerBound(uint64_t key) const {
+    uint64_t left = 0;
+    uint64_t right = this->size;
+    while (left < right) {
+        uint64_t middle = left + (right - left) / 2;
+        if (readBigEndian(this->data + middle * ENTRY_SIZE, 8) < key) {
+            left = middle + 1;
+        }
+        else {
+            right = middle;
+        }
+    }
+    return left;
+}
+uint64_t PolyglotBook::readBigEndian(const uint8_t* data, uint8_t bytes) {
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < bytes; i = i + 1) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+PolyglotBook::PolyglotBook() {
+    this->data = nullptr;
+    this->size = 0;
+#ifdef _WIN32
+    this->file = nullptr;
+    this->mapping = nullptr;
+#else
+    this->file = -1;
+#endif
+    this->random.seed(std::random_device()());
+}
\ No newline at end of file
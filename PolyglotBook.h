@@ -0,0 +1,59 @@
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+#include "LegalMoveGen.h"
+#include "PawnMasks.h"
+#include "PolyglotBookConstants.h"
+
+
+#pragma once
+
+
+class PolyglotBook {
+public:
+    static PolyglotBook* getPtr();
+    PolyglotBook(const PolyglotBook& donor) = delete;
+    ~PolyglotBook();
+
+    bool load(const std::string& path);
+    void close();
+    [[nodiscard]] bool loaded() const;
+
+    [[nodiscard]] uint64_t getKey(const Position& position) const;
+    [[nodiscard]] Move probe(const Position& position, uint8_t side);
+
+    static uint16_t encodeMove(Move move);
+    static Move decodeMove(const Position& position, uint8_t side, uint16_t bookMove);
+
+    struct Entry {
+        uint64_t key;
+        uint16_t move;
+        uint16_t weight;
+        uint32_t learn;
+    };
+    static constexpr uint32_t ENTRY_SIZE = 16;
+    static constexpr uint32_t CASTLING_OFFSET = 768;
+    static constexpr uint32_t EN_PASSANT_OFFSET = 772;
+    static constexpr uint32_t TURN_OFFSET = 780;
+private:
+    PolyglotBook();
+
+    [[nodiscard]] Entry getEntry(uint64_t index) const;
+    [[nodiscard]] uint64_t lowerBound(uint64_t key) const;
+
+    static uint64_t readBigEndian(const uint8_t* data, uint8_t bytes);
+
+    static PolyglotBook* polyglotBook;
+
+    const uint8_t* data;
+    uint64_t size;
+#ifdef _WIN32
+    void* file;
+    void* mapping;
+#else
+    int32_t file;
+#endif
+
+    std::mt19937_64 random;
+};
\ No newline at end of file
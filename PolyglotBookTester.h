@@ -0,0 +1,20 @@
+#include <iomanip>
+#include <iostream>
+#include "Notation.h"
+#include "PolyglotBook.h"
+
+
+#pragma once
+
+
+class PolyglotBookTester {
+public:
+    static void runTests();
+private:
+    struct Test {
+        std::string fen;
+        uint64_t key;
+    };
+
+    static void runTest(const Test& test);
+};
\ No newline at end of file
@@ -1,220 +1,374 @@
-#include "Position.h"
-
-
-
-Position::Position() = default;
-Position::Position(const std::string& shortFen, uint8_t enPassant, bool wlCastling, bool wsCastling, bool blCastling, bool bsCastling, float moveCtr) {
-    this->pieces = { shortFen };
-    this->enPassant = enPassant;
-
-    this->wlCastling = wlCastling;
-    this->wsCastling = wsCastling;
-    this->blCastling = blCastling;
-    this->bsCastling = bsCastling;
-
-    this->moveCtr = moveCtr;
-    this->hash = { this->pieces, this->blackToMove(), this->wlCastling, this->wsCastling, this->blCastling, this->bsCastling };
-    this->repetitionHistory.addPosition(this->hash);
-    this->fiftyMovesCtr = 0;
-    std::cout << "Created position with:" << std::endl;
-    std::cout << "- " << BOp::count1(this->pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN)) << " white pawns" << std::endl;
-    std::cout << "- " << BOp::count1(this->pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN)) << " black pawns" << std::endl;
-    std::cout << "- " << BOp::count1(this->pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING)) << " white king" << std::endl;
-    std::cout << "- " << BOp::count1(this->pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING)) << " black king" << std::endl;
-    std::cout << "Total pieces: " << BOp::count1(this->pieces.getAllBitboard()) << std::endl;
-}
-std::ostream& operator<<(std::ostream& ostream, const Position& position) {
-    ostream << position.pieces << "\n";
-
-    ostream << "En passant: " << (uint32_t)position.enPassant << "\n";
-    ostream << "White long castling: " << position.wlCastling << "\n";
-    ostream << "White short castling: " << position.wsCastling << "\n";
-    ostream << "Black long castling: " << position.blCastling << "\n";
-    ostream << "Black short castling: " << position.blCastling << "\n";
-    ostream << "Move counter: " << position.moveCtr << "\n";
-    ostream << "Zobrist value: " << std::hex << "0x" << position.hash.getValue() << "\n" << std::dec;
-    ostream << "Fifty moves counter: " << position.fiftyMovesCtr << "\n";
-    ostream << "Threefold repetition counter: " << (uint32_t)position.repetitionHistory.getRepetitionNumber(position.hash);
-
-    return ostream;
-}
-void Position::move(Move move) {
-    this->removePiece(move.getFrom(), move.getAttackerType(), move.getAttackerSide());
-    this->addPiece(move.getTo(), move.getAttackerType(), move.getAttackerSide());
-    if (move.getDefenderType() != Move::NONE) {
-        this->removePiece(move.getTo(), move.getDefenderType(), move.getDefenderSide());
-    }
-
-    switch (move.getFlag()) {
-    case Move::FLAG::DEFAULT:
-        break;
-
-    case Move::FLAG::PAWN_LONG_MOVE:
-        this->changeEnPassant((move.getFrom() + move.getTo()) / 2);
-        break;
-    case Move::FLAG::EN_PASSANT_CAPTURE:
-        if (move.getAttackerSide() == SIDE::WHITE) {
-            this->removePiece(move.getTo() - 8, PIECE::PAWN, SIDE::BLACK);
-        }
-        else {
-            this->removePiece(move.getTo() + 8, PIECE::PAWN, SIDE::WHITE);
-        }
-        break;
-
-    case Move::FLAG::WL_CASTLING:
-        this->removePiece(0, PIECE::ROOK, SIDE::WHITE);
-        this->addPiece(3, PIECE::ROOK, SIDE::WHITE);
-        break;
-    case Move::FLAG::WS_CASTLING:
-        this->removePiece(7, PIECE::ROOK, SIDE::WHITE);
-        this->addPiece(5, PIECE::ROOK, SIDE::WHITE);
-        break;
-    case Move::FLAG::BL_CASTLING:
-        this->removePiece(56, PIECE::ROOK, SIDE::BLACK);
-        this->addPiece(59, PIECE::ROOK, SIDE::BLACK);
-        break;
-    case Move::FLAG::BS_CASTLING:
-        this->removePiece(63, PIECE::ROOK, SIDE::BLACK);
-        this->addPiece(61, PIECE::ROOK, SIDE::BLACK);
-        break;
-
-    case Move::FLAG::PROMOTE_TO_KNIGHT:
-        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
-        this->addPiece(move.getTo(), PIECE::KNIGHT, move.getAttackerSide());
-        break;
-    case Move::FLAG::PROMOTE_TO_BISHOP:
-        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
-        this->addPiece(move.getTo(), PIECE::BISHOP, move.getAttackerSide());
-        break;
-    case Move::FLAG::PROMOTE_TO_ROOK:
-        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
-        this->addPiece(move.getTo(), PIECE::ROOK, move.getAttackerSide());
-        break;
-    case Move::FLAG::PROMOTE_TO_QUEEN:
-        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
-        this->addPiece(move.getTo(), PIECE::QUEEN, move.getAttackerSide());
-        break;
-    }
-
-    this->pieces.updateBitboards();
-
-    if (move.getFlag() != Move::FLAG::PAWN_LONG_MOVE) {
-        this->changeEnPassant(Position::NONE);
-    }
-
-    switch (move.getFrom()) {
-    case 0:
-        this->removeWLCastling();
-        break;
-    case 4:
-        this->removeWLCastling();
-        this->removeWSCastling();
-        break;
-    case 7:
-        this->removeWSCastling();
-        break;
-    case 56:
-        this->removeBLCastling();
-        break;
-    case 60:
-        this->removeBLCastling();
-        this->removeBSCastling();
-        break;
-    case 63:
-        this->removeBSCastling();
-        break;
-    }
-
-    this->updateMoveCtr();
-
-    this->updateFiftyMovesCtr(move.getAttackerType() == PIECE::PAWN or move.getDefenderType() != Move::NONE);
-
-    if (move.getAttackerType() == PIECE::PAWN or move.getDefenderType() != Move::NONE) {
-        this->repetitionHistory.clear();
-    }
-    this->repetitionHistory.addPosition(this->hash);
-}
-Pieces Position::getPieces() const {
-    return this->pieces;
-}
-uint8_t Position::getEnPassant() const {
-    return this->enPassant;
-}
-bool Position::getWLCastling() const {
-    return this->wlCastling;
-}
-bool Position::getWSCastling() const {
-    return this->wsCastling;
-}
-bool Position::getBLCastling() const {
-    return this->blCastling;
-}
-bool Position::getBSCastling() const {
-    return this->bsCastling;
-}
-bool Position::whiteToMove() const {
-    return !this->blackToMove();
-}
-bool Position::blackToMove() const {
-    return (this->moveCtr - std::floor(this->moveCtr) > 1e-4);
-}
-ZobristHash Position::getHash() const {
-    return this->hash;
-}
-bool Position::fiftyMovesRuleDraw() const {
-    return (this->fiftyMovesCtr == 50);
-}
-bool Position::threefoldRepetitionDraw() const {
-    return (this->repetitionHistory.getRepetitionNumber(this->hash) == 3);
-}
-void Position::addPiece(uint8_t square, uint8_t type, uint8_t side) {
-    if (!BOp::getBit(this->pieces.getPieceBitboard(side, type), square)) {
-        this->pieces.setPieceBitboard(side, type, BOp::set1(this->pieces.getPieceBitboard(side, type), square));
-        this->hash.invertPiece(square, type, side);
-    }
-}
-void Position::removePiece(uint8_t square, uint8_t type, uint8_t side) {
-    if (BOp::getBit(this->pieces.getPieceBitboard(side, type), square)) {
-        this->pieces.setPieceBitboard(side, type, BOp::set0(this->pieces.getPieceBitboard(side, type), square));
-        this->hash.invertPiece(square, type, side);
-    }
-}
-void Position::changeEnPassant(uint8_t en_passant) {
-    this->enPassant = en_passant;
-}
-void Position::removeWLCastling() {
-    if (this->wlCastling) {
-        this->wlCastling = false;
-        this->hash.invertWLCastling();
-    }
-}
-void Position::removeWSCastling() {
-    if (this->wsCastling) {
-        this->wsCastling = false;
-        this->hash.invertWSCastling();
-    }
-}
-void Position::removeBLCastling() {
-    if (this->blCastling) {
-        this->blCastling = false;
-        this->hash.invertBLCastling();
-    }
-}
-void Position::removeBSCastling() {
-    if (this->bsCastling) {
-        this->bsCastling = false;
-        this->hash.invertBSCastling();
-    }
-}
-void Position::updateMoveCtr() {
-    this->moveCtr = this->moveCtr + 0.5f;
-    this->hash.invertMove();
-}
-void Position::updateFiftyMovesCtr(bool breakEvent) {
-    if (breakEvent) {
-        this->fiftyMovesCtr = 0;
-    }
-    else {
-        this->fiftyMovesCtr = this->fiftyMovesCtr + 0.5f;
-    }
-}
+#include "Position.h"
+
+
+
+Position::Position() = default;
+Position::Position(const std::string& shortFen, uint8_t enPassant, bool wlCastling, bool wsCastling, bool blCastling, bool bsCastling, uint8_t side, uint8_t halfmoveClock, uint16_t fullmoveNumber) {
+    this->pieces = { shortFen };
+    this->enPassant = enPassant;
+
+    this->wlCastling = wlCastling;
+    this->wsCastling = wsCastling;
+    this->blCastling = blCastling;
+    this->bsCastling = bsCastling;
+
+    this->side = side;
+    this->halfmoveClock = halfmoveClock;
+    this->fullmoveNumber = fullmoveNumber;
+    this->hash = this->calcHash();
+    this->updateCheckers();
+    this->dirtyPiecesNumber = 0;
+    LOG(Log::LEVEL::TRACE, "Created position with " << (uint32_t)BOp::count1(this->pieces.getAllBitboard()) << " pieces.");
+}
+std::ostream& operator<<(std::ostream& ostream, const Position& position) {
+    ostream << position.pieces << "\n";
+
+    ostream << "En passant: " << (uint32_t)position.enPassant << "\n";
+    ostream << "White long castling: " << position.wlCastling << "\n";
+    ostream << "White short castling: " << position.wsCastling << "\n";
+    ostream << "Black long castling: " << position.blCastling << "\n";
+    ostream << "Black short castling: " << position.blCastling << "\n";
+    ostream << "Side to move: " << (position.whiteToMove() ? "white" : "black") << "\n";
+    ostream << "Fullmove number: " << position.fullmoveNumber << "\n";
+    ostream << "Zobrist value: " << std::hex << "0x" << position.hash.getValue() << "\n" << std::dec;
+    ostream << "Halfmove clock: " << (uint32_t)position.halfmoveClock;
+
+    return ostream;
+}
+void Position::move(Move move) {
+    this->dirtyPiecesNumber = 0;
+    this->invertEnPassantHash();
+
+    this->removePiece(move.getFrom(), move.getAttackerType(), move.getAttackerSide());
+    if (move.getDefenderType() != Move::NONE) {
+        this->removePiece(move.getTo(), move.getDefenderType(), move.getDefenderSide());
+    }
+    this->addPiece(move.getTo(), move.getAttackerType(), move.getAttackerSide());
+
+    switch (move.getFlag()) {
+    case Move::FLAG::DEFAULT:
+        break;
+
+    case Move::FLAG::PAWN_LONG_MOVE:
+        this->changeEnPassant((move.getFrom() + move.getTo()) / 2);
+        break;
+    case Move::FLAG::EN_PASSANT_CAPTURE:
+        if (move.getAttackerSide() == SIDE::WHITE) {
+            this->removePiece(move.getTo() - 8, PIECE::PAWN, SIDE::BLACK);
+        }
+        else {
+            this->removePiece(move.getTo() + 8, PIECE::PAWN, SIDE::WHITE);
+        }
+        break;
+
+    case Move::FLAG::WL_CASTLING:
+        this->removePiece(0, PIECE::ROOK, SIDE::WHITE);
+        this->addPiece(3, PIECE::ROOK, SIDE::WHITE);
+        break;
+    case Move::FLAG::WS_CASTLING:
+        this->removePiece(7, PIECE::ROOK, SIDE::WHITE);
+        this->addPiece(5, PIECE::ROOK, SIDE::WHITE);
+        break;
+    case Move::FLAG::BL_CASTLING:
+        this->removePiece(56, PIECE::ROOK, SIDE::BLACK);
+        this->addPiece(59, PIECE::ROOK, SIDE::BLACK);
+        break;
+    case Move::FLAG::BS_CASTLING:
+        this->removePiece(63, PIECE::ROOK, SIDE::BLACK);
+        this->addPiece(61, PIECE::ROOK, SIDE::BLACK);
+        break;
+
+    case Move::FLAG::PROMOTE_TO_KNIGHT:
+        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
+        this->addPiece(move.getTo(), PIECE::KNIGHT, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_BISHOP:
+        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
+        this->addPiece(move.getTo(), PIECE::BISHOP, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_ROOK:
+        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
+        this->addPiece(move.getTo(), PIECE::ROOK, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_QUEEN:
+        this->removePiece(move.getTo(), PIECE::PAWN, move.getAttackerSide());
+        this->addPiece(move.getTo(), PIECE::QUEEN, move.getAttackerSide());
+        break;
+    }
+
+    this->pieces.updateBitboards();
+
+    if (move.getFlag() != Move::FLAG::PAWN_LONG_MOVE) {
+        this->changeEnPassant(Position::NONE);
+    }
+
+    switch (move.getFrom()) {
+    case 0:
+        this->removeWLCastling();
+        break;
+    case 4:
+        this->removeWLCastling();
+        this->removeWSCastling();
+        break;
+    case 7:
+        this->removeWSCastling();
+        break;
+    case 56:
+        this->removeBLCastling();
+        break;
+    case 60:
+        this->removeBLCastling();
+        this->removeBSCastling();
+        break;
+    case 63:
+        this->removeBSCastling();
+        break;
+    }
+    switch (move.getTo()) {
+    case 0:
+        this->removeWLCastling();
+        break;
+    case 7:
+        this->removeWSCastling();
+        break;
+    case 56:
+        this->removeBLCastling();
+        break;
+    case 63:
+        this->removeBSCastling();
+        break;
+    }
+
+    this->updateMoveCtr();
+    this->invertEnPassantHash();
+    this->updateCheckers();
+
+    this->updateFiftyMovesCtr(move.getAttackerType() == PIECE::PAWN or move.getDefenderType() != Move::NONE);
+
+#ifdef ZOBRIST_HASH_VERIFICATION
+    this->verifyHash();
+#endif
+}
+Position::Undo Position::getUndo() const {
+    auto castling = (uint8_t)(this->wlCastling | (this->wsCastling << 1) | (this->blCastling << 2) | (this->bsCastling << 3));
+    return {this->hash, this->enPassant, castling, this->halfmoveClock};
+}
+void Position::undoMove(Move move, const Undo& undo) {
+    this->dirtyPiecesNumber = 0;
+
+    switch (move.getFlag()) {
+    case Move::FLAG::WL_CASTLING:
+        this->removePiece(3, PIECE::ROOK, SIDE::WHITE);
+        this->addPiece(0, PIECE::ROOK, SIDE::WHITE);
+        break;
+    case Move::FLAG::WS_CASTLING:
+        this->removePiece(5, PIECE::ROOK, SIDE::WHITE);
+        this->addPiece(7, PIECE::ROOK, SIDE::WHITE);
+        break;
+    case Move::FLAG::BL_CASTLING:
+        this->removePiece(59, PIECE::ROOK, SIDE::BLACK);
+        this->addPiece(56, PIECE::ROOK, SIDE::BLACK);
+        break;
+    case Move::FLAG::BS_CASTLING:
+        this->removePiece(61, PIECE::ROOK, SIDE::BLACK);
+        this->addPiece(63, PIECE::ROOK, SIDE::BLACK);
+        break;
+
+    case Move::FLAG::PROMOTE_TO_KNIGHT:
+        this->removePiece(move.getTo(), PIECE::KNIGHT, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_BISHOP:
+        this->removePiece(move.getTo(), PIECE::BISHOP, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_ROOK:
+        this->removePiece(move.getTo(), PIECE::ROOK, move.getAttackerSide());
+        break;
+    case Move::FLAG::PROMOTE_TO_QUEEN:
+        this->removePiece(move.getTo(), PIECE::QUEEN, move.getAttackerSide());
+        break;
+
+    case Move::FLAG::EN_PASSANT_CAPTURE:
+        if (move.getAttackerSide() == SIDE::WHITE) {
+            this->addPiece(move.getTo() - 8, PIECE::PAWN, SIDE::BLACK);
+        }
+        else {
+            this->addPiece(move.getTo() + 8, PIECE::PAWN, SIDE::WHITE);
+        }
+        break;
+    }
+
+    this->removePiece(move.getTo(), move.getAttackerType(), move.getAttackerSide());
+    if (move.getDefenderType() != Move::NONE) {
+        this->addPiece(move.getTo(), move.getDefenderType(), move.getDefenderSide());
+    }
+    this->addPiece(move.getFrom(), move.getAttackerType(), move.getAttackerSide());
+
+    this->pieces.updateBitboards();
+
+    this->enPassant = undo.enPassant;
+    this->wlCastling = (undo.castling & 1);
+    this->wsCastling = (undo.castling & 2);
+    this->blCastling = (undo.castling & 4);
+    this->bsCastling = (undo.castling & 8);
+    this->halfmoveClock = undo.halfmoveClock;
+    if (this->side == SIDE::WHITE) {
+        this->fullmoveNumber = this->fullmoveNumber - 1;
+    }
+    this->side = move.getAttackerSide();
+    this->hash = undo.hash;
+    this->updateCheckers();
+
+#ifdef ZOBRIST_HASH_VERIFICATION
+    this->verifyHash();
+#endif
+}
+const Pieces& Position::getPieces() const {
+    return this->pieces;
+}
+uint8_t Position::getEnPassant() const {
+    return this->enPassant;
+}
+bool Position::getWLCastling() const {
+    return this->wlCastling;
+}
+bool Position::getWSCastling() const {
+    return this->wsCastling;
+}
+bool Position::getBLCastling() const {
+    return this->blCastling;
+}
+bool Position::getBSCastling() const {
+    return this->bsCastling;
+}
+bool Position::whiteToMove() const {
+    return (this->side == SIDE::WHITE);
+}
+bool Position::blackToMove() const {
+    return (this->side == SIDE::BLACK);
+}
+uint8_t Position::getSide() const {
+    return this->side;
+}
+uint8_t Position::getHalfmoveClock() const {
+    return this->halfmoveClock;
+}
+uint16_t Position::getFullmoveNumber() const {
+    return this->fullmoveNumber;
+}
+ZobristHash Position::getHash() const {
+    return this->hash;
+}
+Bitboard Position::getCheckers() const {
+    return this->checkers;
+}
+bool Position::inCheck() const {
+    return (this->checkers != 0);
+}
+bool Position::fiftyMovesRuleDraw() const {
+    return (this->halfmoveClock >= 100);
+}
+uint8_t Position::getDirtyPiecesNumber() const {
+    return this->dirtyPiecesNumber;
+}
+Position::DirtyPiece Position::getDirtyPiece(uint8_t index) const {
+    return this->dirtyPieces[index];
+}
+void Position::addPiece(uint8_t square, uint8_t type, uint8_t side) {
+    if (!BOp::getBit(this->pieces.getPieceBitboard(side, type), square)) {
+        this->pieces.addPiece(square, type, side);
+        this->hash.invertPiece(square, type, side);
+        this->dirtyPieces[this->dirtyPiecesNumber] = { square, type, side, true };
+        this->dirtyPiecesNumber = this->dirtyPiecesNumber + 1;
+    }
+}
+void Position::removePiece(uint8_t square, uint8_t type, uint8_t side) {
+    if (BOp::getBit(this->pieces.getPieceBitboard(side, type), square)) {
+        this->pieces.removePiece(square, type, side);
+        this->hash.invertPiece(square, type, side);
+        this->dirtyPieces[this->dirtyPiecesNumber] = { square, type, side, false };
+        this->dirtyPiecesNumber = this->dirtyPiecesNumber + 1;
+    }
+}
+void Position::changeEnPassant(uint8_t en_passant) {
+    this->enPassant = en_passant;
+}
+void Position::invertEnPassantHash() {
+    if (this->enPassant != Position::NONE and this->enPassantCapturable()) {
+        this->hash.invertEnPassant(this->enPassant % 8);
+    }
+}
+bool Position::enPassantCapturable() const {
+    if (this->whiteToMove()) {
+        Bitboard pawns = this->pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN);
+        return ((this->enPassant % 8 != 7 and BOp::getBit(pawns, this->enPassant - 7)) or
+            (this->enPassant % 8 != 0 and BOp::getBit(pawns, this->enPassant - 9)));
+    }
+    Bitboard pawns = this->pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN);
+    return ((this->enPassant % 8 != 0 and BOp::getBit(pawns, this->enPassant + 7)) or
+        (this->enPassant % 8 != 7 and BOp::getBit(pawns, this->enPassant + 9)));
+}
+ZobristHash Position::calcHash() const {
+    ZobristHash result = { this->pieces, this->blackToMove(), this->wlCastling, this->wsCastling, this->blCastling, this->bsCastling };
+    if (this->enPassant != Position::NONE and this->enPassantCapturable()) {
+        result.invertEnPassant(this->enPassant % 8);
+    }
+    return result;
+}
+void Position::verifyHash() const {
+#ifdef ZOBRIST_HASH_VERIFICATION
+    static thread_local uint32_t movesSinceCheck = 0;
+    movesSinceCheck = movesSinceCheck + 1;
+    if (movesSinceCheck < ZOBRIST_HASH_VERIFICATION) {
+        return;
+    }
+    movesSinceCheck = 0;
+#endif
+
+    if (!(this->calcHash() == this->hash)) {
+        LOG(Log::LEVEL::WARNING, "Incremental Zobrist hash diverged from recomputation:\n" << *this);
+        std::terminate();
+    }
+}
+void Position::removeWLCastling() {
+    if (this->wlCastling) {
+        this->wlCastling = false;
+        this->hash.invertWLCastling();
+    }
+}
+void Position::removeWSCastling() {
+    if (this->wsCastling) {
+        this->wsCastling = false;
+        this->hash.invertWSCastling();
+    }
+}
+void Position::removeBLCastling() {
+    if (this->blCastling) {
+        this->blCastling = false;
+        this->hash.invertBLCastling();
+    }
+}
+void Position::removeBSCastling() {
+    if (this->bsCastling) {
+        this->bsCastling = false;
+        this->hash.invertBSCastling();
+    }
+}
+void Position::updateCheckers() {
+    uint8_t kingP = BOp::bsf(this->pieces.getPieceBitboard(this->side, PIECE::KING));
+    this->checkers = this->pieces.attackersTo(kingP, this->pieces.getAllBitboard()) & this->pieces.getSideBitboard(Pieces::inverse(this->side));
+}
+void Position::updateMoveCtr() {
+    this->side = Pieces::inverse(this->side);
+    if (this->side == SIDE::WHITE) {
+        this->fullmoveNumber = this->fullmoveNumber + 1;
+    }
+    this->hash.invertMove();
+}
+void Position::updateFiftyMovesCtr(bool breakEvent) {
+    if (breakEvent) {
+        this->halfmoveClock = 0;
+    }
+    else {
+        this->halfmoveClock = this->halfmoveClock + 1;
+    }
+}
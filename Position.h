@@ -1,56 +1,87 @@
-#include <cmath>
-#include "RepetitionHistory.h"
-#include "Move.h"
-
-
-#pragma once
-
-
-class Position {
-public:
-    Position();
-    Position(const std::string& shortFen, uint8_t enPassant, bool wlCastling, bool wsCastling, bool blCastling, bool bsCastling, float moveCtr);
-
-    friend std::ostream& operator <<(std::ostream& ostream, const Position& position);
-
-    void move(Move move);
-
-    [[nodiscard]] Pieces getPieces() const;
-    [[nodiscard]] uint8_t getEnPassant() const;
-    [[nodiscard]] bool getWLCastling() const;
-    [[nodiscard]] bool getWSCastling() const;
-    [[nodiscard]] bool getBLCastling() const;
-    [[nodiscard]] bool getBSCastling() const;
-    [[nodiscard]] bool whiteToMove() const;
-    [[nodiscard]] bool blackToMove() const;
-    [[nodiscard]] ZobristHash getHash() const;
-    [[nodiscard]] bool fiftyMovesRuleDraw() const;
-    [[nodiscard]] bool threefoldRepetitionDraw() const;
-
-    static constexpr uint8_t NONE = 255;
-private:
-    void addPiece(uint8_t square, uint8_t type, uint8_t side);
-    void removePiece(uint8_t square, uint8_t type, uint8_t side);
-    void changeEnPassant(uint8_t en_passant);
-
-    void removeWLCastling();
-    void removeWSCastling();
-    void removeBLCastling();
-    void removeBSCastling();
-
-    void updateMoveCtr();
-    void updateFiftyMovesCtr(bool breakEvent);
-
-    Pieces pieces;
-    uint8_t enPassant;
-
-    bool wlCastling;
-    bool wsCastling;
-    bool blCastling;
-    bool bsCastling;
-
-    float moveCtr;
-    ZobristHash hash;
-    float fiftyMovesCtr;
-    RepetitionHistory repetitionHistory;
-};
+#include "ZobristHash.h"
+#include "Move.h"
+#include "Log.h"
+
+
+#pragma once
+
+
+class Position {
+public:
+    Position();
+    Position(const std::string& shortFen, uint8_t enPassant, bool wlCastling, bool wsCastling, bool blCastling, bool bsCastling, uint8_t side, uint8_t halfmoveClock, uint16_t fullmoveNumber);
+
+    friend std::ostream& operator <<(std::ostream& ostream, const Position& position);
+
+    struct Undo {
+        ZobristHash hash;
+        uint8_t enPassant;
+        uint8_t castling;
+        uint8_t halfmoveClock;
+    };
+
+    void move(Move move);
+    [[nodiscard]] Undo getUndo() const;
+    void undoMove(Move move, const Undo& undo);
+
+    [[nodiscard]] const Pieces& getPieces() const;
+    [[nodiscard]] uint8_t getEnPassant() const;
+    [[nodiscard]] bool getWLCastling() const;
+    [[nodiscard]] bool getWSCastling() const;
+    [[nodiscard]] bool getBLCastling() const;
+    [[nodiscard]] bool getBSCastling() const;
+    [[nodiscard]] bool whiteToMove() const;
+    [[nodiscard]] bool blackToMove() const;
+    [[nodiscard]] uint8_t getSide() const;
+    [[nodiscard]] uint8_t getHalfmoveClock() const;
+    [[nodiscard]] uint16_t getFullmoveNumber() const;
+    [[nodiscard]] ZobristHash getHash() const;
+    [[nodiscard]] Bitboard getCheckers() const;
+    [[nodiscard]] bool inCheck() const;
+    [[nodiscard]] bool fiftyMovesRuleDraw() const;
+
+    struct DirtyPiece {
+        uint8_t square;
+        uint8_t type;
+        uint8_t side;
+        bool added;
+    };
+    [[nodiscard]] uint8_t getDirtyPiecesNumber() const;
+    [[nodiscard]] DirtyPiece getDirtyPiece(uint8_t index) const;
+
+    static constexpr uint8_t NONE = 255;
+private:
+    void addPiece(uint8_t square, uint8_t type, uint8_t side);
+    void removePiece(uint8_t square, uint8_t type, uint8_t side);
+    void changeEnPassant(uint8_t en_passant);
+    void invertEnPassantHash();
+    [[nodiscard]] bool enPassantCapturable() const;
+    [[nodiscard]] ZobristHash calcHash() const;
+    void verifyHash() const;
+
+    void removeWLCastling();
+    void removeWSCastling();
+    void removeBLCastling();
+    void removeBSCastling();
+
+    void updateCheckers();
+    void updateMoveCtr();
+    void updateFiftyMovesCtr(bool breakEvent);
+
+    Pieces pieces;
+    uint8_t enPassant;
+
+    bool wlCastling;
+    bool wsCastling;
+    bool blCastling;
+    bool bsCastling;
+
+    uint8_t side;
+    uint8_t halfmoveClock;
+    uint16_t fullmoveNumber;
+    ZobristHash hash;
+    Bitboard checkers;
+
+    std::array<DirtyPiece, 6> dirtyPieces;
+    uint8_t dirtyPiecesNumber;
+};
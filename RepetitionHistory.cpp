@@ -1,19 +1,53 @@
-#include "RepetitionHistory.h"
-
-
-RepetitionHistory::RepetitionHistory() = default;
-void RepetitionHistory::addPosition(ZobristHash hash) {
-    this->hashes.push_back(hash);
-}
-void RepetitionHistory::clear() {
-    this->hashes.clear();
-}
-uint8_t RepetitionHistory::getRepetitionNumber(ZobristHash hash) const {
-    uint8_t ctr = 0;
-    for (auto hash1 : this->hashes) {
-        if (hash == hash1) {
-            ctr = ctr + 1;
-        }
-    }
-    return ctr;
-}
\ No newline at end of file
+#include "RepetitionHistory.h"
+
+
+RepetitionHistory::RepetitionHistory() {
+    this->size = 0;
+    this->root = 0;
+}
+void RepetitionHistory::push(ZobristHash hash) {
+    this->hashes[this->size % SIZE] = hash;
+    this->size = this->size + 1;
+}
+void RepetitionHistory::pop() {
+    this->size = this->size - 1;
+}
+void RepetitionHistory::clear() {
+    this->size = 0;
+    this->root = 0;
+}
+void RepetitionHistory::markRoot() {
+    this->root = this->size - 1;
+}
+uint8_t RepetitionHistory::getRepetitionNumber(uint8_t halfmoveClock) const {
+    uint32_t last = this->size - 1;
+    ZobristHash hash = this->hashes[last % SIZE];
+    uint32_t limit = std::min({ (uint32_t)halfmoveClock, last, SIZE - 1 });
+
+    uint8_t ctr = 1;
+    for (uint32_t i = 4; i <= limit; i = i + 2) {
+        if (this->hashes[(last - i) % SIZE] == hash) {
+            ctr = ctr + 1;
+        }
+    }
+    return ctr;
+}
+bool RepetitionHistory::draw(uint8_t halfmoveClock) const {
+    uint32_t last = this->size - 1;
+    ZobristHash hash = this->hashes[last % SIZE];
+    uint32_t limit = std::min({ (uint32_t)halfmoveClock, last, SIZE - 1 });
+
+    uint8_t ctr = 1;
+    for (uint32_t i = 4; i <= limit; i = i + 2) {
+        if (this->hashes[(last - i) % SIZE] == hash) {
+            if (last - i > this->root) {
+                return true;
+            }
+            ctr = ctr + 1;
+            if (ctr == 3) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -1,17 +1,25 @@
-#include <vector>
-#include "ZobristHash.h"
-
-
-#pragma once
-
-
-class RepetitionHistory {
-public:
-    RepetitionHistory();
-
-    void addPosition(ZobristHash hash);
-    void clear();
-    [[nodiscard]] uint8_t getRepetitionNumber(ZobristHash hash) const;
-private:
-    std::vector<ZobristHash> hashes;
-};
+#include <algorithm>
+#include <array>
+#include "ZobristHash.h"
+
+
+#pragma once
+
+
+class RepetitionHistory {
+public:
+    RepetitionHistory();
+
+    void push(ZobristHash hash);
+    void pop();
+    void clear();
+    void markRoot();
+    [[nodiscard]] uint8_t getRepetitionNumber(uint8_t halfmoveClock) const;
+    [[nodiscard]] bool draw(uint8_t halfmoveClock) const;
+
+    static constexpr uint32_t SIZE = 256;
+private:
+    std::array<ZobristHash, SIZE> hashes;
+    uint32_t size;
+    uint32_t root;
+};
@@ -1,24 +1,24 @@
-#include "SearchInterrupter.h"
-
-
-SearchInterrupter* SearchInterrupter::interrupter = nullptr;
-
-
-SearchInterrupter* SearchInterrupter::getPtr() {
-    if (interrupter == nullptr) {
-        interrupter = new SearchInterrupter();
-    }
-    return interrupter;
-}
-void SearchInterrupter::interrupt() {
-    this->halt = true;
-}
-void SearchInterrupter::resume() {
-    this->halt = false;
-}
-bool SearchInterrupter::interrupted() const {
-    return this->halt;
-}
-SearchInterrupter::SearchInterrupter() {
-    this->halt = false;
+#include "SearchInterrupter.h"
+
+
+SearchInterrupter* SearchInterrupter::interrupter = nullptr;
+
+
+SearchInterrupter* SearchInterrupter::getPtr() {
+    if (interrupter == nullptr) {
+        interrupter = new SearchInterrupter();
+    }
+    return interrupter;
+}
+void SearchInterrupter::interrupt() {
+    this->halt.store(true, std::memory_order_relaxed);
+}
+void SearchInterrupter::resume() {
+    this->halt.store(false, std::memory_order_relaxed);
+}
+bool SearchInterrupter::interrupted() const {
+    return this->halt.load(std::memory_order_relaxed);
+}
+SearchInterrupter::SearchInterrupter() {
+    this->halt = false;
 }
\ No newline at end of file
@@ -1,18 +1,21 @@
-#pragma once
-
-
-class SearchInterrupter {
-public:
-    static SearchInterrupter* getPtr();
-    SearchInterrupter(const SearchInterrupter& donor) = delete;
-
-    void interrupt();
-    void resume();
-    [[nodiscard]] bool interrupted() const;
-private:
-    SearchInterrupter();
-
-    static SearchInterrupter* interrupter;
-
-    bool halt;
+#include <atomic>
+
+
+#pragma once
+
+
+class SearchInterrupter {
+public:
+    static SearchInterrupter* getPtr();
+    SearchInterrupter(const SearchInterrupter& donor) = delete;
+
+    void interrupt();
+    void resume();
+    [[nodiscard]] bool interrupted() const;
+private:
+    SearchInterrupter();
+
+    static SearchInterrupter* interrupter;
+
+    std::atomic<bool> halt;
 };
\ No newline at end of file
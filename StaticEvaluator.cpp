@@ -1,276 +1,341 @@
-#include "StaticEvaluator.h"
-
-int32_t StaticEvaluator::evaluate(Pieces pieces, bool showDebugInfo) {
-    int32_t evaluation = 0;
-
-    int32_t materialEvaluation = material(pieces);
-    int32_t mobilityEvaluation = mobility(pieces);
-    int32_t doublePawnEvaluation = doublePawn(pieces);
-    int32_t connectedPawnEvaluation = connectedPawn(pieces);
-    int32_t pawnPromotionEvaluation = pawnPromotion(pieces);
-    int32_t kingSafetyEvaluation = kingSafety(pieces);
-    int32_t endgameEvaluation = endgame(pieces, materialEvaluation >= 0);
-
-    evaluation = evaluation + materialEvaluation;
-    evaluation = evaluation + mobilityEvaluation;
-    evaluation = evaluation + doublePawnEvaluation;
-    evaluation = evaluation + connectedPawnEvaluation;
-    evaluation = evaluation + pawnPromotionEvaluation;
-    evaluation = evaluation + kingSafetyEvaluation;
-    evaluation = evaluation + endgameEvaluation;
-
-    if (showDebugInfo) {
-        std::cout << "Material: " << (float)materialEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Mobility: " << (float)mobilityEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Double pawn: " << (float)doublePawnEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Connected pawn: " << (float)connectedPawnEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Pawn promotion: " << (float)pawnPromotionEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "King safety: " << (float)kingSafetyEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Endgame: " << (float)endgameEvaluation / 100.f << " pawns." << std::endl;
-        std::cout << "Total: " << (float)evaluation / 100.f << " pawns." << std::endl;
-    }
-
-    return evaluation;
-}
-int32_t StaticEvaluator::material(Pieces pieces) {
-    int32_t material = 0;
-
-    material = material + MATERIAL::PAWN * (BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN)) -
-        BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN)));
-
-    material = material + MATERIAL::KNIGHT * (BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KNIGHT)) -
-        BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KNIGHT)));
-
-    material = material + MATERIAL::BISHOP * (BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::BISHOP)) -
-        BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::BISHOP)));
-
-    material = material + MATERIAL::ROOK * (BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::ROOK)) -
-        BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::ROOK)));
-
-    material = material + MATERIAL::QUEEN * (BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::QUEEN)) -
-        BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::QUEEN)));
-
-    return material;
-}
-int32_t StaticEvaluator::mobility(Pieces pieces) {
-    int32_t mobility = 0;
-
-    std::array<std::array<Bitboard, 6>, 2> masks = pieces.getPieceBitboards();
-    int32_t knightMoves = 0;
-    int32_t bishopMoves = 0;
-    int32_t rookMoves = 0;
-    int32_t queenMoves = 0;
-
-    Bitboard whitePawnsLeftAttacks = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::WHITE, true);
-    Bitboard whitePawnsRightAttacks = PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::WHITE, true);
-    Bitboard whitePawnsAttacks = whitePawnsLeftAttacks | whitePawnsRightAttacks;
-    Bitboard safeForBlack = ~whitePawnsAttacks;
-
-    Bitboard blackPawnsLeftAttacks = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::BLACK, true);
-    Bitboard blackPawnsRightAttacks = PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::BLACK, true);
-    Bitboard blackPawnsAttacks = blackPawnsLeftAttacks | blackPawnsRightAttacks;
-    Bitboard safeForWhite = ~blackPawnsAttacks;
-
-    while (masks[SIDE::WHITE][PIECE::KNIGHT]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::KNIGHT]);
-        masks[SIDE::WHITE][PIECE::KNIGHT] = BOp::set0(masks[SIDE::WHITE][PIECE::KNIGHT], index);
-        knightMoves = knightMoves + BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
-    }
-    while (masks[SIDE::WHITE][PIECE::BISHOP]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::BISHOP]);
-        masks[SIDE::WHITE][PIECE::BISHOP] = BOp::set0(masks[SIDE::WHITE][PIECE::BISHOP], index);
-        bishopMoves = bishopMoves + BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
-    }
-    while (masks[SIDE::WHITE][PIECE::ROOK]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::ROOK]);
-        masks[SIDE::WHITE][PIECE::ROOK] = BOp::set0(masks[SIDE::WHITE][PIECE::ROOK], index);
-        rookMoves = rookMoves + BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
-    }
-    while (masks[SIDE::WHITE][PIECE::QUEEN]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::QUEEN]);
-        masks[SIDE::WHITE][PIECE::QUEEN] = BOp::set0(masks[SIDE::WHITE][PIECE::QUEEN], index);
-        queenMoves = queenMoves + BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
-    }
-    while (masks[SIDE::BLACK][PIECE::KNIGHT]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::KNIGHT]);
-        masks[SIDE::BLACK][PIECE::KNIGHT] = BOp::set0(masks[SIDE::BLACK][PIECE::KNIGHT], index);
-        knightMoves = knightMoves - BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
-    }
-    while (masks[SIDE::BLACK][PIECE::BISHOP]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::BISHOP]);
-        masks[SIDE::BLACK][PIECE::BISHOP] = BOp::set0(masks[SIDE::BLACK][PIECE::BISHOP], index);
-        bishopMoves = bishopMoves - BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
-    }
-    while (masks[SIDE::BLACK][PIECE::ROOK]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::ROOK]);
-        masks[SIDE::BLACK][PIECE::ROOK] = BOp::set0(masks[SIDE::BLACK][PIECE::ROOK], index);
-        rookMoves = rookMoves - BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
-    }
-    while (masks[SIDE::BLACK][PIECE::QUEEN]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::QUEEN]);
-        masks[SIDE::BLACK][PIECE::QUEEN] = BOp::set0(masks[SIDE::BLACK][PIECE::QUEEN], index);
-        queenMoves = queenMoves - BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
-    }
-
-    mobility = mobility + MOBILITY::KNIGHT * knightMoves;
-    mobility = mobility + MOBILITY::BISHOP * bishopMoves;
-    mobility = mobility + MOBILITY::ROOK * rookMoves;
-    mobility = mobility + MOBILITY::QUEEN * queenMoves;
-
-    return mobility;
-}
-int32_t StaticEvaluator::doublePawn(Pieces pieces) {
-    int32_t doublePawnsNumber = 0;
-
-    for (uint8_t x = 0; x < 8; x = x + 1) {
-        uint8_t whitePawns = BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN) & BColumns::COLUMNS[x]);
-        uint8_t blackPawns = BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN) & BColumns::COLUMNS[x]);
-
-        doublePawnsNumber = doublePawnsNumber + std::max(0, whitePawns - 1);
-        doublePawnsNumber = doublePawnsNumber - std::max(0, blackPawns - 1);
-    }
-
-    return PAWN_STRUCTURE::DOUBLE_PAWN * doublePawnsNumber;
-}
-int32_t StaticEvaluator::connectedPawn(Pieces pieces) {
-    int32_t connectedPawnsNumber = 0;
-
-    Bitboard whiteCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::WHITE, true) | PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::WHITE, true);
-    Bitboard blackCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::BLACK, true) | PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::BLACK, true);
-
-    connectedPawnsNumber = connectedPawnsNumber + BOp::count1(whiteCaptures & pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN));
-    connectedPawnsNumber = connectedPawnsNumber - BOp::count1(blackCaptures & pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN));
-
-    return PAWN_STRUCTURE::CONNECTED_PAWN * connectedPawnsNumber;
-}
-int32_t StaticEvaluator::pawnPromotion(Pieces pieces) {
-    int32_t pawnPromotion = 0;
-
-    Bitboard whitePawns = pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN);
-    Bitboard blackPawns = pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN);
-
-    while (whitePawns) {
-        uint8_t index = BOp::bsf(whitePawns);
-        whitePawns = BOp::set0(whitePawns, index);
-        if (PassedPawnMasks::WHITE_PASSED_PAWN_MASKS[index] & pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN)) {
-            pawnPromotion = pawnPromotion + PAWN_STRUCTURE::DEFAULT_PAWN_PROMOTION[index / 8];
-        }
-        else {
-            pawnPromotion = pawnPromotion + PAWN_STRUCTURE::PASSED_PAWN_PROMOTION[index / 8];
-        }
-    }
-    while (blackPawns) {
-        uint8_t index = BOp::bsf(blackPawns);
-        blackPawns = BOp::set0(blackPawns, index);
-        if (PassedPawnMasks::BLACK_PASSED_PAWN_MASKS[index] & pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN)) {
-            pawnPromotion = pawnPromotion - PAWN_STRUCTURE::DEFAULT_PAWN_PROMOTION[7 - index / 8];
-        }
-        else {
-            pawnPromotion = pawnPromotion - PAWN_STRUCTURE::PASSED_PAWN_PROMOTION[7 - index / 8];
-        }
-    }
-
-    return pawnPromotion;
-}
-int32_t StaticEvaluator::kingSafety(Pieces pieces) {
-    int32_t kingSafety = 0;
-
-    if (BOp::count1(pieces.getAllBitboard()) <= ENDGAME::MAXIMUM_PIECES_FOR_ENDGAME) {
-        return kingSafety;
-    }
-
-    uint8_t whiteKingP = BOp::bsf(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING));
-    uint8_t blackKingP = BOp::bsf(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING));
-
-    Bitboard whiteKingArea = KingMasks::MASKS[whiteKingP];
-    Bitboard blackKingArea = KingMasks::MASKS[blackKingP];
-
-    std::array<std::array<Bitboard, 6>, 2> masks = pieces.getPieceBitboards();
-    int32_t knightMoves = 0;
-    int32_t bishopMoves = 0;
-    int32_t rookMoves = 0;
-    int32_t queenMoves = 0;
-
-    while (masks[SIDE::WHITE][PIECE::KNIGHT]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::KNIGHT]);
-        masks[SIDE::WHITE][PIECE::KNIGHT] = BOp::set0(masks[SIDE::WHITE][PIECE::KNIGHT], index);
-        knightMoves = knightMoves + BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
-    }
-    while (masks[SIDE::WHITE][PIECE::BISHOP]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::BISHOP]);
-        masks[SIDE::WHITE][PIECE::BISHOP] = BOp::set0(masks[SIDE::WHITE][PIECE::BISHOP], index);
-        bishopMoves = bishopMoves + BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
-    }
-    while (masks[SIDE::WHITE][PIECE::ROOK]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::ROOK]);
-        masks[SIDE::WHITE][PIECE::ROOK] = BOp::set0(masks[SIDE::WHITE][PIECE::ROOK], index);
-        rookMoves = rookMoves + BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
-    }
-    while (masks[SIDE::WHITE][PIECE::QUEEN]) {
-        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::QUEEN]);
-        masks[SIDE::WHITE][PIECE::QUEEN] = BOp::set0(masks[SIDE::WHITE][PIECE::QUEEN], index);
-        queenMoves = queenMoves + BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
-    }
-    while (masks[SIDE::BLACK][PIECE::KNIGHT]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::KNIGHT]);
-        masks[SIDE::BLACK][PIECE::KNIGHT] = BOp::set0(masks[SIDE::BLACK][PIECE::KNIGHT], index);
-        knightMoves = knightMoves - BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
-    }
-    while (masks[SIDE::BLACK][PIECE::BISHOP]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::BISHOP]);
-        masks[SIDE::BLACK][PIECE::BISHOP] = BOp::set0(masks[SIDE::BLACK][PIECE::BISHOP], index);
-        bishopMoves = bishopMoves - BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
-    }
-    while (masks[SIDE::BLACK][PIECE::ROOK]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::ROOK]);
-        masks[SIDE::BLACK][PIECE::ROOK] = BOp::set0(masks[SIDE::BLACK][PIECE::ROOK], index);
-        rookMoves = rookMoves - BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
-    }
-    while (masks[SIDE::BLACK][PIECE::QUEEN]) {
-        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::QUEEN]);
-        masks[SIDE::BLACK][PIECE::QUEEN] = BOp::set0(masks[SIDE::BLACK][PIECE::QUEEN], index);
-        queenMoves = queenMoves - BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
-    }
-
-    kingSafety = kingSafety + KING_SAFETY::KNIGHT * knightMoves;
-    kingSafety = kingSafety + KING_SAFETY::BISHOP * bishopMoves;
-    kingSafety = kingSafety + KING_SAFETY::ROOK * rookMoves;
-    kingSafety = kingSafety + KING_SAFETY::QUEEN * queenMoves;
-
-    return kingSafety;
-}
-int32_t StaticEvaluator::endgame(Pieces pieces, bool whiteStronger) {
-    int32_t endgame = 0;
-
-    if (BOp::count1(pieces.getAllBitboard()) > ENDGAME::MAXIMUM_PIECES_FOR_ENDGAME) {
-        return endgame;
-    }
-
-    uint8_t attackerSide;
-    uint8_t defenderSide;
-    if (whiteStronger) {
-        attackerSide = SIDE::WHITE;
-        defenderSide = SIDE::BLACK;
-    }
-    else {
-        attackerSide = SIDE::BLACK;
-        defenderSide = SIDE::WHITE;
-    }
-
-    uint8_t attackerKingP = BOp::bsf(pieces.getPieceBitboard(attackerSide, PIECE::KING));
-    int8_t attackerKingX = attackerKingP % 8;
-    int8_t attackerKingY = attackerKingP / 8;
-
-    uint8_t defenderKingP = BOp::bsf(pieces.getPieceBitboard(defenderSide, PIECE::KING));
-    int8_t defenderKingX = defenderKingP % 8;
-    int8_t defenderKingY = defenderKingP / 8;
-
-    endgame = endgame + ENDGAME::PROXIMITY_KINGS * (16 - std::abs(attackerKingX - defenderKingX) - std::abs(attackerKingY - defenderKingY));
-    endgame = endgame + ENDGAME::DISTANCE_WEAK_KING_MIDDLE * (std::abs(defenderKingX - 3) + std::abs(defenderKingY - 4));
-
-    if (!whiteStronger) {
-        endgame = -endgame;
-    }
-
-    return endgame;
-}
+#include "StaticEvaluator.h"
+
+int32_t StaticEvaluator::evaluate(const Pieces& pieces) {
+    return getBreakdown(pieces).total;
+}
+StaticEvaluator::Breakdown StaticEvaluator::getBreakdown(const Pieces& pieces) {
+    Breakdown breakdown{};
+
+    breakdown.material = material(pieces);
+    breakdown.mobility = mobility(pieces);
+    breakdown.doublePawn = doublePawn(pieces);
+    breakdown.connectedPawn = connectedPawn(pieces);
+    breakdown.pawnPromotion = pawnPromotion(pieces);
+    breakdown.kingSafety = kingSafety(pieces);
+    breakdown.endgame = endgame(pieces, breakdown.material >= 0);
+
+    breakdown.total = breakdown.material;
+    breakdown.total = breakdown.total + breakdown.mobility;
+    breakdown.total = breakdown.total + breakdown.doublePawn;
+    breakdown.total = breakdown.total + breakdown.connectedPawn;
+    breakdown.total = breakdown.total + breakdown.pawnPromotion;
+    breakdown.total = breakdown.total + breakdown.kingSafety;
+    breakdown.total = breakdown.total + breakdown.endgame;
+
+    return breakdown;
+}
+std::ostream& operator<<(std::ostream& ostream, const StaticEvaluator::Breakdown& breakdown) {
+    ostream << "Material: " << (float)breakdown.material / 100.f << " pawns.\n";
+    ostream << "Mobility: " << (float)breakdown.mobility / 100.f << " pawns.\n";
+    ostream << "Double pawn: " << (float)breakdown.doublePawn / 100.f << " pawns.\n";
+    ostream << "Connected pawn: " << (float)breakdown.connectedPawn / 100.f << " pawns.\n";
+    ostream << "Pawn promotion: " << (float)breakdown.pawnPromotion / 100.f << " pawns.\n";
+    ostream << "King safety: " << (float)breakdown.kingSafety / 100.f << " pawns.\n";
+    ostream << "Endgame: " << (float)breakdown.endgame / 100.f << " pawns.\n";
+    ostream << "Total: " << (float)breakdown.total / 100.f << " pawns.";
+
+    return ostream;
+}
+std::array<int32_t, StaticEvaluator::PARAMETERS_NUMBER> StaticEvaluator::getParameters() {
+    std::array<int32_t, PARAMETERS_NUMBER> parameters = {
+        MATERIAL::PAWN, MATERIAL::KNIGHT, MATERIAL::BISHOP, MATERIAL::ROOK, MATERIAL::QUEEN,
+        MOBILITY::KNIGHT, MOBILITY::BISHOP, MOBILITY::ROOK, MOBILITY::QUEEN,
+        PAWN_STRUCTURE::DOUBLE_PAWN, PAWN_STRUCTURE::CONNECTED_PAWN
+    };
+
+    uint8_t index = 11;
+    for (int32_t weight : PAWN_STRUCTURE::DEFAULT_PAWN_PROMOTION) {
+        parameters[index] = weight;
+        index = index + 1;
+    }
+    for (int32_t weight : PAWN_STRUCTURE::PASSED_PAWN_PROMOTION) {
+        parameters[index] = weight;
+        index = index + 1;
+    }
+    for (int32_t weight : { KING_SAFETY::KNIGHT, KING_SAFETY::BISHOP, KING_SAFETY::ROOK, KING_SAFETY::QUEEN, ENDGAME::PROXIMITY_KINGS, ENDGAME::DISTANCE_WEAK_KING_MIDDLE }) {
+        parameters[index] = weight;
+        index = index + 1;
+    }
+
+    return parameters;
+}
+std::array<int32_t, StaticEvaluator::PARAMETERS_NUMBER> StaticEvaluator::getFeatures(const Pieces& pieces) {
+    std::array<int32_t, PARAMETERS_NUMBER> features{};
+    uint8_t index = 0;
+
+    for (int32_t feature : materialFeatures(pieces)) {
+        features[index] = feature;
+        index = index + 1;
+    }
+    for (int32_t feature : mobilityFeatures(pieces)) {
+        features[index] = feature;
+        index = index + 1;
+    }
+    features[index] = doublePawnFeature(pieces);
+    features[index + 1] = connectedPawnFeature(pieces);
+    index = index + 2;
+    for (int32_t feature : pawnPromotionFeatures(pieces)) {
+        features[index] = feature;
+        index = index + 1;
+    }
+    for (int32_t feature : kingSafetyFeatures(pieces)) {
+        features[index] = feature;
+        index = index + 1;
+    }
+    for (int32_t feature : endgameFeatures(pieces, material(pieces) >= 0)) {
+        features[index] = feature;
+        index = index + 1;
+    }
+
+    return features;
+}
+int32_t StaticEvaluator::material(const Pieces& pieces) {
+    return weigh(materialFeatures(pieces), { MATERIAL::PAWN, MATERIAL::KNIGHT, MATERIAL::BISHOP, MATERIAL::ROOK, MATERIAL::QUEEN });
+}
+int32_t StaticEvaluator::mobility(const Pieces& pieces) {
+    return weigh(mobilityFeatures(pieces), { MOBILITY::KNIGHT, MOBILITY::BISHOP, MOBILITY::ROOK, MOBILITY::QUEEN });
+}
+int32_t StaticEvaluator::doublePawn(const Pieces& pieces) {
+    return PAWN_STRUCTURE::DOUBLE_PAWN * doublePawnFeature(pieces);
+}
+int32_t StaticEvaluator::connectedPawn(const Pieces& pieces) {
+    return PAWN_STRUCTURE::CONNECTED_PAWN * connectedPawnFeature(pieces);
+}
+int32_t StaticEvaluator::pawnPromotion(const Pieces& pieces) {
+    std::array<int32_t, 16> features = pawnPromotionFeatures(pieces);
+
+    int32_t pawnPromotion = 0;
+    for (uint8_t y = 0; y < 8; y = y + 1) {
+        pawnPromotion = pawnPromotion + PAWN_STRUCTURE::DEFAULT_PAWN_PROMOTION[y] * features[y];
+        pawnPromotion = pawnPromotion + PAWN_STRUCTURE::PASSED_PAWN_PROMOTION[y] * features[8 + y];
+    }
+    return pawnPromotion;
+}
+int32_t StaticEvaluator::kingSafety(const Pieces& pieces) {
+    return weigh(kingSafetyFeatures(pieces), { KING_SAFETY::KNIGHT, KING_SAFETY::BISHOP, KING_SAFETY::ROOK, KING_SAFETY::QUEEN });
+}
+int32_t StaticEvaluator::endgame(const Pieces& pieces, bool whiteStronger) {
+    return weigh(endgameFeatures(pieces, whiteStronger), { ENDGAME::PROXIMITY_KINGS, ENDGAME::DISTANCE_WEAK_KING_MIDDLE });
+}
+std::array<int32_t, 5> StaticEvaluator::materialFeatures(const Pieces& pieces) {
+    std::array<int32_t, 5> features{};
+
+    for (uint8_t type = PIECE::PAWN; type <= PIECE::QUEEN; type = type + 1) {
+        features[type] = BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, type)) - BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, type));
+    }
+
+    return features;
+}
+std::array<int32_t, 4> StaticEvaluator::mobilityFeatures(const Pieces& pieces) {
+    std::array<std::array<Bitboard, 6>, 2> masks = pieces.getPieceBitboards();
+    int32_t knightMoves = 0;
+    int32_t bishopMoves = 0;
+    int32_t rookMoves = 0;
+    int32_t queenMoves = 0;
+
+    Bitboard whitePawnsLeftAttacks = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::WHITE, true);
+    Bitboard whitePawnsRightAttacks = PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::WHITE, true);
+    Bitboard whitePawnsAttacks = whitePawnsLeftAttacks | whitePawnsRightAttacks;
+    Bitboard safeForBlack = ~whitePawnsAttacks;
+
+    Bitboard blackPawnsLeftAttacks = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::BLACK, true);
+    Bitboard blackPawnsRightAttacks = PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::BLACK, true);
+    Bitboard blackPawnsAttacks = blackPawnsLeftAttacks | blackPawnsRightAttacks;
+    Bitboard safeForWhite = ~blackPawnsAttacks;
+
+    while (masks[SIDE::WHITE][PIECE::KNIGHT]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::KNIGHT]);
+        masks[SIDE::WHITE][PIECE::KNIGHT] = BOp::set0(masks[SIDE::WHITE][PIECE::KNIGHT], index);
+        knightMoves = knightMoves + BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
+    }
+    while (masks[SIDE::WHITE][PIECE::BISHOP]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::BISHOP]);
+        masks[SIDE::WHITE][PIECE::BISHOP] = BOp::set0(masks[SIDE::WHITE][PIECE::BISHOP], index);
+        bishopMoves = bishopMoves + BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
+    }
+    while (masks[SIDE::WHITE][PIECE::ROOK]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::ROOK]);
+        masks[SIDE::WHITE][PIECE::ROOK] = BOp::set0(masks[SIDE::WHITE][PIECE::ROOK], index);
+        rookMoves = rookMoves + BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
+    }
+    while (masks[SIDE::WHITE][PIECE::QUEEN]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::QUEEN]);
+        masks[SIDE::WHITE][PIECE::QUEEN] = BOp::set0(masks[SIDE::WHITE][PIECE::QUEEN], index);
+        queenMoves = queenMoves + BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::WHITE, false) & safeForWhite);
+    }
+    while (masks[SIDE::BLACK][PIECE::KNIGHT]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::KNIGHT]);
+        masks[SIDE::BLACK][PIECE::KNIGHT] = BOp::set0(masks[SIDE::BLACK][PIECE::KNIGHT], index);
+        knightMoves = knightMoves - BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
+    }
+    while (masks[SIDE::BLACK][PIECE::BISHOP]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::BISHOP]);
+        masks[SIDE::BLACK][PIECE::BISHOP] = BOp::set0(masks[SIDE::BLACK][PIECE::BISHOP], index);
+        bishopMoves = bishopMoves - BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
+    }
+    while (masks[SIDE::BLACK][PIECE::ROOK]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::ROOK]);
+        masks[SIDE::BLACK][PIECE::ROOK] = BOp::set0(masks[SIDE::BLACK][PIECE::ROOK], index);
+        rookMoves = rookMoves - BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
+    }
+    while (masks[SIDE::BLACK][PIECE::QUEEN]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::QUEEN]);
+        masks[SIDE::BLACK][PIECE::QUEEN] = BOp::set0(masks[SIDE::BLACK][PIECE::QUEEN], index);
+        queenMoves = queenMoves - BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::BLACK, false) & safeForBlack);
+    }
+
+    return { knightMoves, bishopMoves, rookMoves, queenMoves };
+}
+int32_t StaticEvaluator::doublePawnFeature(const Pieces& pieces) {
+    int32_t doublePawnsNumber = 0;
+
+    for (uint8_t x = 0; x < 8; x = x + 1) {
+        uint8_t whitePawns = BOp::count1(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN) & BColumns::COLUMNS[x]);
+        uint8_t blackPawns = BOp::count1(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN) & BColumns::COLUMNS[x]);
+
+        doublePawnsNumber = doublePawnsNumber + std::max(0, whitePawns - 1);
+        doublePawnsNumber = doublePawnsNumber - std::max(0, blackPawns - 1);
+    }
+
+    return doublePawnsNumber;
+}
+int32_t StaticEvaluator::connectedPawnFeature(const Pieces& pieces) {
+    int32_t connectedPawnsNumber = 0;
+
+    Bitboard whiteCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::WHITE, true) | PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::WHITE, true);
+    Bitboard blackCaptures = PsLegalMoveMaskGen::generatePawnsLeftCapturesMask(pieces, SIDE::BLACK, true) | PsLegalMoveMaskGen::generatePawnsRightCapturesMask(pieces, SIDE::BLACK, true);
+
+    connectedPawnsNumber = connectedPawnsNumber + BOp::count1(whiteCaptures & pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN));
+    connectedPawnsNumber = connectedPawnsNumber - BOp::count1(blackCaptures & pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN));
+
+    return connectedPawnsNumber;
+}
+std::array<int32_t, 16> StaticEvaluator::pawnPromotionFeatures(const Pieces& pieces) {
+    std::array<int32_t, 16> features{};
+
+    Bitboard whitePawns = pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN);
+    Bitboard blackPawns = pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN);
+
+    while (whitePawns) {
+        uint8_t index = BOp::bsf(whitePawns);
+        whitePawns = BOp::set0(whitePawns, index);
+        if (PassedPawnMasks::WHITE_PASSED_PAWN_MASKS[index] & pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN)) {
+            features[index / 8] = features[index / 8] + 1;
+        }
+        else {
+            features[8 + index / 8] = features[8 + index / 8] + 1;
+        }
+    }
+    while (blackPawns) {
+        uint8_t index = BOp::bsf(blackPawns);
+        blackPawns = BOp::set0(blackPawns, index);
+        if (PassedPawnMasks::BLACK_PASSED_PAWN_MASKS[index] & pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN)) {
+            features[7 - index / 8] = features[7 - index / 8] - 1;
+        }
+        else {
+            features[15 - index / 8] = features[15 - index / 8] - 1;
+        }
+    }
+
+    return features;
+}
+std::array<int32_t, 4> StaticEvaluator::kingSafetyFeatures(const Pieces& pieces) {
+    if (BOp::count1(pieces.getAllBitboard()) <= ENDGAME::MAXIMUM_PIECES_FOR_ENDGAME) {
+        return {};
+    }
+
+    uint8_t whiteKingP = BOp::bsf(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING));
+    uint8_t blackKingP = BOp::bsf(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING));
+
+    Bitboard whiteKingArea = KingMasks::MASKS[whiteKingP];
+    Bitboard blackKingArea = KingMasks::MASKS[blackKingP];
+
+    std::array<std::array<Bitboard, 6>, 2> masks = pieces.getPieceBitboards();
+    int32_t knightMoves = 0;
+    int32_t bishopMoves = 0;
+    int32_t rookMoves = 0;
+    int32_t queenMoves = 0;
+
+    while (masks[SIDE::WHITE][PIECE::KNIGHT]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::KNIGHT]);
+        masks[SIDE::WHITE][PIECE::KNIGHT] = BOp::set0(masks[SIDE::WHITE][PIECE::KNIGHT], index);
+        knightMoves = knightMoves + BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
+    }
+    while (masks[SIDE::WHITE][PIECE::BISHOP]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::BISHOP]);
+        masks[SIDE::WHITE][PIECE::BISHOP] = BOp::set0(masks[SIDE::WHITE][PIECE::BISHOP], index);
+        bishopMoves = bishopMoves + BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
+    }
+    while (masks[SIDE::WHITE][PIECE::ROOK]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::ROOK]);
+        masks[SIDE::WHITE][PIECE::ROOK] = BOp::set0(masks[SIDE::WHITE][PIECE::ROOK], index);
+        rookMoves = rookMoves + BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
+    }
+    while (masks[SIDE::WHITE][PIECE::QUEEN]) {
+        uint8_t index = BOp::bsf(masks[SIDE::WHITE][PIECE::QUEEN]);
+        masks[SIDE::WHITE][PIECE::QUEEN] = BOp::set0(masks[SIDE::WHITE][PIECE::QUEEN], index);
+        queenMoves = queenMoves + BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::WHITE, false) & blackKingArea);
+    }
+    while (masks[SIDE::BLACK][PIECE::KNIGHT]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::KNIGHT]);
+        masks[SIDE::BLACK][PIECE::KNIGHT] = BOp::set0(masks[SIDE::BLACK][PIECE::KNIGHT], index);
+        knightMoves = knightMoves - BOp::count1(PsLegalMoveMaskGen::generateKnightMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
+    }
+    while (masks[SIDE::BLACK][PIECE::BISHOP]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::BISHOP]);
+        masks[SIDE::BLACK][PIECE::BISHOP] = BOp::set0(masks[SIDE::BLACK][PIECE::BISHOP], index);
+        bishopMoves = bishopMoves - BOp::count1(PsLegalMoveMaskGen::generateBishopMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
+    }
+    while (masks[SIDE::BLACK][PIECE::ROOK]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::ROOK]);
+        masks[SIDE::BLACK][PIECE::ROOK] = BOp::set0(masks[SIDE::BLACK][PIECE::ROOK], index);
+        rookMoves = rookMoves - BOp::count1(PsLegalMoveMaskGen::generateRookMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
+    }
+    while (masks[SIDE::BLACK][PIECE::QUEEN]) {
+        uint8_t index = BOp::bsf(masks[SIDE::BLACK][PIECE::QUEEN]);
+        masks[SIDE::BLACK][PIECE::QUEEN] = BOp::set0(masks[SIDE::BLACK][PIECE::QUEEN], index);
+        queenMoves = queenMoves - BOp::count1(PsLegalMoveMaskGen::generateQueenMask(pieces, index, SIDE::BLACK, false) & whiteKingArea);
+    }
+
+    return { knightMoves, bishopMoves, rookMoves, queenMoves };
+}
+std::array<int32_t, 2> StaticEvaluator::endgameFeatures(const Pieces& pieces, bool whiteStronger) {
+    if (BOp::count1(pieces.getAllBitboard()) > ENDGAME::MAXIMUM_PIECES_FOR_ENDGAME) {
+        return {};
+    }
+
+    uint8_t attackerSide;
+    uint8_t defenderSide;
+    if (whiteStronger) {
+        attackerSide = SIDE::WHITE;
+        defenderSide = SIDE::BLACK;
+    }
+    else {
+        attackerSide = SIDE::BLACK;
+        defenderSide = SIDE::WHITE;
+    }
+
+    uint8_t attackerKingP = BOp::bsf(pieces.getPieceBitboard(attackerSide, PIECE::KING));
+    int8_t attackerKingX = attackerKingP % 8;
+    int8_t attackerKingY = attackerKingP / 8;
+
+    uint8_t defenderKingP = BOp::bsf(pieces.getPieceBitboard(defenderSide, PIECE::KING));
+    int8_t defenderKingX = defenderKingP % 8;
+    int8_t defenderKingY = defenderKingP / 8;
+
+    int32_t proximityKings = 16 - std::abs(attackerKingX - defenderKingX) - std::abs(attackerKingY - defenderKingY);
+    int32_t distanceWeakKingMiddle = std::abs(defenderKingX - 3) + std::abs(defenderKingY - 4);
+
+    if (!whiteStronger) {
+        return { -proximityKings, -distanceWeakKingMiddle };
+    }
+    return { proximityKings, distanceWeakKingMiddle };
+}
+template<size_t N>
+int32_t StaticEvaluator::weigh(const std::array<int32_t, N>& features, const std::array<int32_t, N>& weights) {
+    int32_t sum = 0;
+    for (size_t i = 0; i < N; i = i + 1) {
+        sum = sum + features[i] * weights[i];
+    }
+    return sum;
+}
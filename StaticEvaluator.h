@@ -1,52 +1,56 @@
-#include "PsLegalMoveMaskGen.h"
-#include "PassedPawnMasks.h"
-
-
-#pragma once
-
-
-class StaticEvaluator {
-public:
-    static int32_t evaluate(Pieces pieces, bool showDebugInfo = false);
-private:
-    static int32_t material(Pieces pieces);
-    static int32_t mobility(Pieces pieces);
-    static int32_t doublePawn(Pieces pieces);
-    static int32_t connectedPawn(Pieces pieces);
-    static int32_t pawnPromotion(Pieces pieces);
-    static int32_t kingSafety(Pieces pieces);
-    static int32_t endgame(Pieces pieces, bool whiteStronger);
-
-    struct MATERIAL {
-        static constexpr int32_t PAWN = 100;
-        static constexpr int32_t KNIGHT = 300;
-        static constexpr int32_t BISHOP = 325;
-        static constexpr int32_t ROOK = 550;
-        static constexpr int32_t QUEEN = 950;
-    };
-    struct MOBILITY {
-        static constexpr int32_t KNIGHT = 12;
-        static constexpr int32_t BISHOP = 8;
-        static constexpr int32_t ROOK = 5;
-        static constexpr int32_t QUEEN = 5;
-    };
-    struct PAWN_STRUCTURE {
-        static constexpr int32_t DOUBLE_PAWN = -25;
-        static constexpr int32_t CONNECTED_PAWN = 10;
-        static constexpr std::array<int32_t, 8> DEFAULT_PAWN_PROMOTION = { 0, 0, 0, 0, 10, 20, 30, 0 };
-        static constexpr std::array<int32_t, 8> PASSED_PAWN_PROMOTION = { 0, 50, 50, 50, 70, 90, 110, 0 };
-    };
-    struct KING_SAFETY {
-        static constexpr int32_t KNIGHT = 25;
-        static constexpr int32_t BISHOP = 25;
-        static constexpr int32_t ROOK = 25;
-        static constexpr int32_t QUEEN = 50;
-    };
-    struct ENDGAME {
-        static constexpr int32_t MAXIMUM_PIECES_FOR_ENDGAME = 8;
-        static constexpr int32_t PROXIMITY_KINGS = 10;
-        static constexpr int32_t DISTANCE_WEAK_KING_MIDDLE = 10;
-    };
-
-    friend class MoveSorter;
+#include "PsLegalMoveMaskGen.h"
+#include "PassedPawnMasks.h"
+#include "StaticEvaluatorParameters.h"
+
+
+#pragma once
+
+
+class StaticEvaluator {
+public:
+    struct Breakdown {
+        int32_t material;
+        int32_t mobility;
+        int32_t doublePawn;
+        int32_t connectedPawn;
+        int32_t pawnPromotion;
+        int32_t kingSafety;
+        int32_t endgame;
+        int32_t total;
+    };
+
+    static int32_t evaluate(const Pieces& pieces);
+    static Breakdown getBreakdown(const Pieces& pieces);
+    friend std::ostream& operator <<(std::ostream& ostream, const Breakdown& breakdown);
+
+    static constexpr uint8_t PARAMETERS_NUMBER = 33;
+    static std::array<int32_t, PARAMETERS_NUMBER> getParameters();
+    static std::array<int32_t, PARAMETERS_NUMBER> getFeatures(const Pieces& pieces);
+private:
+    static int32_t material(const Pieces& pieces);
+    static int32_t mobility(const Pieces& pieces);
+    static int32_t doublePawn(const Pieces& pieces);
+    static int32_t connectedPawn(const Pieces& pieces);
+    static int32_t pawnPromotion(const Pieces& pieces);
+    static int32_t kingSafety(const Pieces& pieces);
+    static int32_t endgame(const Pieces& pieces, bool whiteStronger);
+
+    static std::array<int32_t, 5> materialFeatures(const Pieces& pieces);
+    static std::array<int32_t, 4> mobilityFeatures(const Pieces& pieces);
+    static int32_t doublePawnFeature(const Pieces& pieces);
+    static int32_t connectedPawnFeature(const Pieces& pieces);
+    static std::array<int32_t, 16> pawnPromotionFeatures(const Pieces& pieces);
+    static std::array<int32_t, 4> kingSafetyFeatures(const Pieces& pieces);
+    static std::array<int32_t, 2> endgameFeatures(const Pieces& pieces, bool whiteStronger);
+
+    template<size_t N>
+    static int32_t weigh(const std::array<int32_t, N>& features, const std::array<int32_t, N>& weights);
+
+    using MATERIAL = StaticEvaluatorParameters::MATERIAL;
+    using MOBILITY = StaticEvaluatorParameters::MOBILITY;
+    using PAWN_STRUCTURE = StaticEvaluatorParameters::PAWN_STRUCTURE;
+    using KING_SAFETY = StaticEvaluatorParameters::KING_SAFETY;
+    using ENDGAME = StaticEvaluatorParameters::ENDGAME;
+
+    friend class MoveSorter;
 };
\ No newline at end of file
@@ -0,0 +1,1024 @@
+#include "Syzygy.h"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+Syzygy* Syzygy::syzygy = nullptr;
+
+
+Syzygy* Syzygy::getPtr() {
+    if (syzygy == nullptr) {
+        syzygy = new Syzygy();
+    }
+    return syzygy;
+}
+Syzygy::~Syzygy() {
+    for (auto& typeTables : this->tables) {
+        for (auto& [name, table] : typeTables) {
+            unmapTable(*table);
+        }
+    }
+}
+void Syzygy::setPath(const std::string& newPath) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    for (auto& typeTables : this->tables) {
+        for (auto& [name, table] : typeTables) {
+            unmapTable(*table);
+        }
+        typeTables.clear();
+    }
+    for (auto& typeAvailable : this->available) {
+        typeAvailable.clear();
+    }
+    this->path = newPath;
+    this->largest = 0;
+
+    std::error_code error;
+    for (const auto& file : std::filesystem::directory_iterator(newPath, error)) {
+        if (!file.is_regular_file(error)) {
+            continue;
+        }
+        std::string name = file.path().stem().string();
+        std::string extension = file.path().extension().string();
+        if (name.find('v') == std::string::npos or name.size() > MAX_PIECES + 1 or canonicalName(name) != name) {
+            continue;
+        }
+        for (uint8_t type = 0; type < 2; type = type + 1) {
+            if (extension == EXTENSIONS[type]) {
+                this->available[type].insert(name);
+            }
+        }
+        if (extension == EXTENSIONS[TABLE::WDL_TABLE]) {
+            this->largest = std::max(this->largest, (uint8_t)(name.size() - 1));
+        }
+    }
+}
+void Syzygy::setProbeDepth(int32_t newProbeDepth) {
+    this->probeDepth = std::max(1, newProbeDepth);
+}
+void Syzygy::setPieceLimit(uint8_t newPieceLimit) {
+    this->pieceLimit = std::min(newPieceLimit, MAX_PIECES);
+}
+uint8_t Syzygy::getCardinality() const {
+    return std::min(this->largest, this->pieceLimit);
+}
+int32_t Syzygy::getProbeDepth() const {
+    return this->probeDepth;
+}
+uint64_t Syzygy::getHits() const {
+    return this->hits;
+}
+void Syzygy::resetHits() {
+    this->hits = 0;
+}
+bool Syzygy::canProbe(const Position& position) const {
+    if (position.getWLCastling() or position.getWSCastling() or position.getBLCastling() or position.getBSCastling()) {
+        return false;
+    }
+    uint8_t cardinality = this->getCardinality();
+    return (cardinality != 0 and BOp::count1(position.getPieces().getAllBitboard()) <= cardinality);
+}
+bool Syzygy::canProbe(const Position& position, int32_t depthLeft) const {
+    if (position.getHalfmoveClock() != 0 or !this->canProbe(position)) {
+        return false;
+    }
+    return (BOp::count1(position.getPieces().getAllBitboard()) < this->getCardinality() or depthLeft >= this->probeDepth);
+}
+int8_t Syzygy::probeWDL(const Position& position, bool& success) {
+    uint8_t state = STATE::OK;
+    int8_t wdl = this->search(position, false, state);
+    success = (state != STATE::FAIL);
+    if (success) {
+        this->hits = this->hits + 1;
+    }
+    return wdl;
+}
+int32_t Syzygy::probeDTZ(const Position& position, bool& success) {
+    uint8_t state = STATE::OK;
+    int32_t dtz = this->probeDTZ(position, state);
+    success = (state != STATE::FAIL);
+    if (success) {
+        this->hits = this->hits + 1;
+    }
+    return dtz;
+}
+bool Syzygy::filterRootMoves(const Position& position, MoveList& moves, int8_t& wdl) {
+    if (!this->canProbe(position)) {
+        return false;
+    }
+
+    MoveList all = LegalMoveGen::generate(position, position.getSide());
+    std::vector<int32_t> ranks;
+    int32_t bestRank = INT32_MIN;
+
+    for (uint8_t i = 0; i < all.getSize(); i = i + 1) {
+        Position copy = position;
+        copy.move(all[i]);
+
+        uint8_t state = STATE::OK;
+        int32_t dtz;
+        if (copy.getHalfmoveClock() == 0) {
+            dtz = dtzBeforeZeroing((int8_t)-this->search(copy, false, state));
+        }
+        else {
+            dtz = -this->probeDTZ(copy, state);
+            dtz = (dtz > 0) ? dtz + 1 : (dtz < 0) ? dtz - 1 : dtz;
+        }
+        if (copy.inCheck() and dtz == 2 and LegalMoveGen::generate(copy, copy.getSide()).getSize() == 0) {
+            dtz = 1;
+        }
+        if (state == STATE::FAIL) {
+            return false;
+        }
+
+        int32_t rank = 1000;
+        if (dtz > 0 and dtz + position.getHalfmoveClock() <= 100) {
+            rank = 2000 - dtz;
+        }
+        else if (dtz < 0 and -dtz + position.getHalfmoveClock() <= 100) {
+            rank = -dtz;
+        }
+        ranks.push_back(rank);
+        bestRank = std::max(bestRank, rank);
+    }
+    if (all.getSize() == 0) {
+        return false;
+    }
+
+    moves = MoveList();
+    for (uint8_t i = 0; i < all.getSize(); i = i + 1) {
+        if (ranks[i] == bestRank) {
+            moves.push(all[i]);
+        }
+    }
+    wdl = (bestRank > 1000) ? WDL::WIN : (bestRank == 1000) ? WDL::DRAW : WDL::LOSS;
+    this->hits = this->hits + 1;
+    return true;
+}
+Syzygy::PairsData* Syzygy::Table::get(uint8_t stm, uint8_t tbFile) {
+    return &this->items[this->type == TABLE::DTZ_TABLE ? 0 : stm][this->hasPawns ? tbFile : 0];
+}
+std::string Syzygy::getPath(const std::string& name, uint8_t type) const {
+    return this->path + "/" + name + EXTENSIONS[type];
+}
+void Syzygy::initTable(Table& table, const std::string& name, uint8_t type) {
+    size_t separator = name.find('v');
+    std::array<std::string, 2> sides = {name.substr(0, separator), name.substr(separator + 1)};
+
+    table.name = name;
+    table.mirroredName = sides[1] + "v" + sides[0];
+    table.type = type;
+    table.pieceCount = (uint8_t)(name.size() - 1);
+    table.hasPawns = (name.find('P') != std::string::npos);
+    table.hasUniquePieces = false;
+    for (const std::string& side : sides) {
+        for (char piece : std::string("QRBNP")) {
+            if (std::count(side.begin(), side.end(), piece) == 1) {
+                table.hasUniquePieces = true;
+            }
+        }
+    }
+
+    auto whitePawns = (uint8_t)std::count(sides[0].begin(), sides[0].end(), 'P');
+    auto blackPawns = (uint8_t)std::count(sides[1].begin(), sides[1].end(), 'P');
+    bool whiteLeads = (blackPawns == 0 or (whitePawns != 0 and blackPawns >= whitePawns));
+    table.pawnCount = {whiteLeads ? whitePawns : blackPawns, whiteLeads ? blackPawns : whitePawns};
+
+    table.items = {};
+    table.map = nullptr;
+    table.base = nullptr;
+    table.size = 0;
+#ifdef _WIN32
+    table.file = nullptr;
+    table.mapping = nullptr;
+#else
+    table.file = -1;
+#endif
+}
+Syzygy::Table* Syzygy::getTable(const Position& position, uint8_t type) {
+    std::string name = canonicalName(getName(position, false));
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    auto found = this->tables[type].find(name);
+    if (found != this->tables[type].end()) {
+        return (found->second->base != nullptr) ? found->second.get() : nullptr;
+    }
+    if (!this->available[type].contains(name)) {
+        return nullptr;
+    }
+
+    auto table = std::make_unique<Table>();
+    initTable(*table, name, type);
+    if (!this->mapTable(*table) or !this->setup(*table)) {
+        unmapTable(*table);
+    }
+
+    Table* result = (table->base != nullptr) ? table.get() : nullptr;
+    this->tables[type][name] = std::move(table);
+    return result;
+}
+bool Syzygy::mapTable(Table& table) {
+    std::string filePath = this->getPath(table.name, table.type);
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) or fileSize.QuadPart < 5) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    table.file = file;
+    table.mapping = mapping;
+    table.base = static_cast<const uint8_t*>(view);
+    table.size = (uint64_t)fileSize.QuadPart;
+#else
+    int32_t file = open(filePath.c_str(), O_RDONLY);
+    if (file == -1) {
+        return false;
+    }
+    struct stat fileStat{};
+    if (fstat(file, &fileStat) == -1 or fileStat.st_size < 5) {
+        ::close(file);
+        return false;
+    }
+    void* view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, file, 0);
+    if (view == MAP_FAILED) {
+        ::close(file);
+        return false;
+    }
+    table.file = file;
+    table.base = static_cast<const uint8_t*>(view);
+    table.size = (uint64_t)fileStat.st_size;
+#endif
+
+    return (std::memcmp(table.base, MAGICS[table.type].data(), 4) == 0);
+}
+void Syzygy::unmapTable(Table& table) {
+    if (table.base == nullptr) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(table.base);
+    CloseHandle(table.mapping);
+    CloseHandle(table.file);
+    table.mapping = nullptr;
+    table.file = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(table.base), table.size);
+    ::close(table.file);
+    table.file = -1;
+#endif
+
+    table.base = nullptr;
+    table.size = 0;
+}
+bool Syzygy::setup(Table& table) {
+    const uint8_t* base = table.base;
+    const uint8_t* data = base + 4;
+
+    if ((bool)(*data & 2) != table.hasPawns) {
+        return false;
+    }
+    data = data + 1;
+
+    uint8_t sides = (table.type == TABLE::WDL_TABLE and table.name != table.mirroredName) ? 2 : 1;
+    uint8_t maxFile = table.hasPawns ? 3 : 0;
+    bool pp = (table.hasPawns and table.pawnCount[1] != 0);
+
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        std::array<std::array<uint8_t, 2>, 2> order = {{
+            {(uint8_t)(data[0] & 0xF), (uint8_t)(pp ? data[1] & 0xF : 0xF)},
+            {(uint8_t)(data[0] >> 4), (uint8_t)(pp ? data[1] >> 4 : 0xF)}
+        }};
+        data = data + 1 + pp;
+
+        for (uint8_t k = 0; k < table.pieceCount; k = k + 1) {
+            for (uint8_t i = 0; i < sides; i = i + 1) {
+                table.items[i][file].pieces[k] = i ? (*data >> 4) : (*data & 0xF);
+            }
+            data = data + 1;
+        }
+        for (uint8_t i = 0; i < sides; i = i + 1) {
+            this->setGroups(table, table.items[i][file], order[i], file);
+        }
+    }
+    data = data + ((data - base) & 1);
+
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        for (uint8_t i = 0; i < sides; i = i + 1) {
+            data = setSizes(table.items[i][file], data);
+        }
+    }
+    if (table.type == TABLE::DTZ_TABLE) {
+        data = setDtzMap(table, data, base, maxFile);
+    }
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        for (uint8_t i = 0; i < sides; i = i + 1) {
+            table.items[i][file].sparseIndex = data;
+            data = data + table.items[i][file].sparseIndexSize * 6;
+        }
+    }
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        for (uint8_t i = 0; i < sides; i = i + 1) {
+            table.items[i][file].blockLength = data;
+            data = data + table.items[i][file].blockLengthSize * 2;
+        }
+    }
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        for (uint8_t i = 0; i < sides; i = i + 1) {
+            data = base + ((data - base + 0x3F) & ~0x3F);
+            table.items[i][file].data = data;
+            data = data + table.items[i][file].numBlocks * table.items[i][file].sizeofBlock;
+        }
+    }
+
+    return (data <= base + table.size);
+}
+void Syzygy::setGroups(Table& table, PairsData& d, const std::array<uint8_t, 2>& order, uint8_t tbFile) const {
+    uint8_t n = 0;
+    int32_t firstLen = table.hasPawns ? 0 : (table.hasUniquePieces ? 3 : 2);
+    d.groupLen[n] = 1;
+    for (uint8_t i = 1; i < table.pieceCount; i = i + 1) {
+        firstLen = firstLen - 1;
+        if (firstLen > 0 or d.pieces[i] == d.pieces[i - 1]) {
+            d.groupLen[n] = d.groupLen[n] + 1;
+        }
+        else {
+            n = n + 1;
+            d.groupLen[n] = 1;
+        }
+    }
+    n = n + 1;
+    d.groupLen[n] = 0;
+
+    bool pp = (table.hasPawns and table.pawnCount[1] != 0);
+    uint8_t next = pp ? 2 : 1;
+    uint8_t freeSquares = 64 - d.groupLen[0] - (pp ? d.groupLen[1] : 0);
+    uint64_t index = 1;
+    for (uint8_t k = 0; next < n or k == order[0] or k == order[1]; k = k + 1) {
+        if (k == order[0]) {
+            d.groupIdx[0] = index;
+            if (table.hasPawns) {
+                index = index * this->leadPawnsSize[d.groupLen[0]][tbFile];
+            }
+            else {
+                index = index * (table.hasUniquePieces ? 31332 : 462);
+            }
+        }
+        else if (k == order[1]) {
+            d.groupIdx[1] = index;
+            index = index * this->binomial[d.groupLen[1]][48 - d.groupLen[0]];
+        }
+        else {
+            d.groupIdx[next] = index;
+            index = index * this->binomial[d.groupLen[next]][freeSquares];
+            freeSquares = freeSquares - d.groupLen[next];
+            next = next + 1;
+        }
+    }
+    d.groupIdx[n] = index;
+}
+const uint8_t* Syzygy::setSizes(PairsData& d, const uint8_t* data) {
+    d.flags = *data;
+    data = data + 1;
+
+    if (d.flags & FLAG::SINGLE_VALUE) {
+        d.numBlocks = 0;
+        d.span = 0;
+        d.blockLengthSize = 0;
+        d.sparseIndexSize = 0;
+        d.minSymLen = *data;
+        return data + 1;
+    }
+
+    uint8_t groups = 0;
+    while (d.groupLen[groups] != 0) {
+        groups = groups + 1;
+    }
+    uint64_t tbSize = d.groupIdx[groups];
+
+    d.sizeofBlock = 1ULL << data[0];
+    d.span = 1ULL << data[1];
+    d.sparseIndexSize = (tbSize + d.span - 1) / d.span;
+    uint8_t padding = data[2];
+    d.numBlocks = readLE32(data + 3);
+    d.blockLengthSize = d.numBlocks + padding;
+    d.maxSymLen = data[7];
+    d.minSymLen = data[8];
+    data = data + 9;
+
+    d.lowestSym = data;
+    d.base64.assign(d.maxSymLen - d.minSymLen + 1, 0);
+    for (int32_t i = (int32_t)d.base64.size() - 2; i >= 0; i = i - 1) {
+        d.base64[i] = (d.base64[i + 1] + readLE16(d.lowestSym + 2 * i) - readLE16(d.lowestSym + 2 * (i + 1))) / 2;
+    }
+    for (uint32_t i = 0; i < d.base64.size(); i = i + 1) {
+        d.base64[i] = d.base64[i] << (64 - i - d.minSymLen);
+    }
+    data = data + d.base64.size() * 2;
+
+    d.symlen.assign(readLE16(data), 0);
+    data = data + 2;
+    d.btree = data;
+
+    std::vector<bool> visited(d.symlen.size());
+    for (uint16_t sym = 0; sym < d.symlen.size(); sym = sym + 1) {
+        if (!visited[sym]) {
+            d.symlen[sym] = setSymlen(d, sym, visited);
+        }
+    }
+
+    return data + d.symlen.size() * 3 + (d.symlen.size() & 1);
+}
+uint8_t Syzygy::setSymlen(PairsData& d, uint16_t sym, std::vector<bool>& visited) {
+    visited[sym] = true;
+
+    uint16_t right = rightSymbol(d, sym);
+    if (right == 0xFFF) {
+        return 0;
+    }
+    uint16_t left = leftSymbol(d, sym);
+
+    if (!visited[left]) {
+        d.symlen[left] = setSymlen(d, left, visited);
+    }
+    if (!visited[right]) {
+        d.symlen[right] = setSymlen(d, right, visited);
+    }
+    return d.symlen[left] + d.symlen[right] + 1;
+}
+uint16_t Syzygy::leftSymbol(const PairsData& d, uint16_t sym) {
+    const uint8_t* pair = d.btree + 3 * sym;
+    return ((pair[1] & 0xF) << 8) | pair[0];
+}
+uint16_t Syzygy::rightSymbol(const PairsData& d, uint16_t sym) {
+    const uint8_t* pair = d.btree + 3 * sym;
+    return (pair[2] << 4) | (pair[1] >> 4);
+}
+const uint8_t* Syzygy::setDtzMap(Table& table, const uint8_t* data, const uint8_t* base, uint8_t maxFile) {
+    table.map = data;
+
+    for (uint8_t file = 0; file <= maxFile; file = file + 1) {
+        PairsData& d = table.items[0][file];
+        if (!(d.flags & FLAG::MAPPED)) {
+            continue;
+        }
+        if (d.flags & FLAG::WIDE) {
+            data = data + ((data - base) & 1);
+            for (uint8_t i = 0; i < 4; i = i + 1) {
+                d.mapIdx[i] = (uint16_t)((data - table.map) / 2 + 1);
+                data = data + 2 * readLE16(data) + 2;
+            }
+        }
+        else {
+            for (uint8_t i = 0; i < 4; i = i + 1) {
+                d.mapIdx[i] = (uint16_t)(data - table.map + 1);
+                data = data + *data + 1;
+            }
+        }
+    }
+
+    return data + ((data - base) & 1);
+}
+int32_t Syzygy::probeTable(const Position& position, uint8_t type, int8_t wdl, uint8_t& state) {
+    if (BOp::count1(position.getPieces().getAllBitboard()) == 2) {
+        return WDL::DRAW;
+    }
+
+    Table* table = this->getTable(position, type);
+    if (table == nullptr) {
+        state = STATE::FAIL;
+        return 0;
+    }
+    return this->doProbeTable(position, *table, wdl, state);
+}
+int32_t Syzygy::doProbeTable(const Position& position, Table& table, int8_t wdl, uint8_t& state) const {
+    uint8_t stm;
+    uint8_t tbFile;
+    uint64_t index = this->getIndex(position, table, stm, tbFile);
+
+    if (table.type == TABLE::DTZ_TABLE) {
+        uint8_t flags = table.get(stm, tbFile)->flags;
+        if ((flags & FLAG::STM) != stm and (table.name != table.mirroredName or table.hasPawns)) {
+            state = STATE::CHANGE_STM;
+            return 0;
+        }
+    }
+
+    return mapScore(table, tbFile, decompressPairs(*table.get(stm, tbFile), index), wdl);
+}
+uint64_t Syzygy::getIndex(const Position& position, Table& table, uint8_t& stm, uint8_t& tbFile) const {
+    const Pieces& board = position.getPieces();
+
+    std::array<uint8_t, MAX_PIECES> squares{};
+    std::array<uint8_t, MAX_PIECES> pieces{};
+    uint8_t size = 0;
+    uint8_t leadPawnsCnt = 0;
+    Bitboard leadPawns = 0;
+    tbFile = 0;
+
+    bool symmetricBlackToMove = (table.name == table.mirroredName and position.blackToMove());
+    bool blackStronger = (getName(position, false) != table.name);
+    bool flip = (symmetricBlackToMove or blackStronger);
+    uint8_t flipColor = flip ? 8 : 0;
+    uint8_t flipSquares = flip ? 56 : 0;
+    stm = flip ^ position.blackToMove();
+
+    auto pawnsComparator = [this](uint8_t left, uint8_t right) {
+        return this->mapPawns[left] < this->mapPawns[right];
+    };
+
+    if (table.hasPawns) {
+        uint8_t piece = table.get(0, 0)->pieces[0] ^ flipColor;
+        leadPawns = board.getPieceBitboard(piece >> 3, PIECE::PAWN);
+        Bitboard bb = leadPawns;
+        while (bb) {
+            uint8_t square = BOp::bsf(bb);
+            bb = BOp::set0(bb, square);
+            squares[size] = square ^ flipSquares;
+            size = size + 1;
+        }
+        leadPawnsCnt = size;
+        std::swap(squares[0], *std::max_element(squares.begin(), squares.begin() + leadPawnsCnt, pawnsComparator));
+        tbFile = std::min(squares[0] % 8, 7 - squares[0] % 8);
+    }
+
+    Bitboard bb = board.getAllBitboard() & ~leadPawns;
+    while (bb) {
+        uint8_t square = BOp::bsf(bb);
+        bb = BOp::set0(bb, square);
+        for (uint8_t side = 0; side < 2; side = side + 1) {
+            for (uint8_t type = 0; type < 6; type = type + 1) {
+                if (BOp::getBit(board.getPieceBitboard(side, type), square)) {
+                    squares[size] = square ^ flipSquares;
+                    pieces[size] = tbPiece(type, side) ^ flipColor;
+                }
+            }
+        }
+        size = size + 1;
+    }
+
+    const PairsData* d = table.get(stm, tbFile);
+
+    for (uint8_t i = leadPawnsCnt; i + 1 < size; i = i + 1) {
+        for (uint8_t j = i + 1; j < size; j = j + 1) {
+            if (d->pieces[i] == pieces[j]) {
+                std::swap(pieces[i], pieces[j]);
+                std::swap(squares[i], squares[j]);
+                break;
+            }
+        }
+    }
+
+    if (squares[0] % 8 > 3) {
+        for (uint8_t i = 0; i < size; i = i + 1) {
+            squares[i] = squares[i] ^ 7;
+        }
+    }
+
+    uint64_t index;
+    if (table.hasPawns) {
+        index = this->leadPawnIdx[leadPawnsCnt][squares[0]];
+        std::stable_sort(squares.begin() + 1, squares.begin() + leadPawnsCnt, pawnsComparator);
+        for (uint8_t i = 1; i < leadPawnsCnt; i = i + 1) {
+            index = index + this->binomial[i][this->mapPawns[squares[i]]];
+        }
+    }
+    else {
+        if (squares[0] / 8 > 3) {
+            for (uint8_t i = 0; i < size; i = i + 1) {
+                squares[i] = squares[i] ^ 56;
+            }
+        }
+
+        for (uint8_t i = 0; i < d->groupLen[0]; i = i + 1) {
+            if (offA1H8(squares[i]) == 0) {
+                continue;
+            }
+            if (offA1H8(squares[i]) > 0) {
+                for (uint8_t j = i; j < size; j = j + 1) {
+                    squares[j] = ((squares[j] >> 3) | (squares[j] << 3)) & 63;
+                }
+            }
+            break;
+        }
+
+        if (table.hasUniquePieces) {
+            int32_t adjust1 = (squares[1] > squares[0]);
+            int32_t adjust2 = (squares[2] > squares[0]) + (squares[2] > squares[1]);
+
+            if (offA1H8(squares[0]) != 0) {
+                index = (this->mapA1D1D4[squares[0]] * 63 + (squares[1] - adjust1)) * 62 + squares[2] - adjust2;
+            }
+            else if (offA1H8(squares[1]) != 0) {
+                index = (6 * 63 + (squares[0] / 8) * 28 + this->mapB1H1H7[squares[1]]) * 62 + squares[2] - adjust2;
+            }
+            else if (offA1H8(squares[2]) != 0) {
+                index = 6 * 63 * 62 + 4 * 28 * 62 + (squares[0] / 8) * 7 * 28 + (squares[1] / 8 - adjust1) * 28 + this->mapB1H1H7[squares[2]];
+            }
+            else {
+                index = 6 * 63 * 62 + 4 * 28 * 62 + 4 * 7 * 28 + (squares[0] / 8) * 7 * 6 + (squares[1] / 8 - adjust1) * 6 + (squares[2] / 8 - adjust2);
+            }
+        }
+        else {
+            index = this->mapKK[this->mapA1D1D4[squares[0]]][squares[1]];
+        }
+    }
+
+    index = index * d->groupIdx[0];
+
+    uint8_t groupStart = d->groupLen[0];
+    bool remainingPawns = (table.hasPawns and table.pawnCount[1] != 0);
+    for (uint8_t next = 1; d->groupLen[next] != 0; next = next + 1) {
+        std::stable_sort(squares.begin() + groupStart, squares.begin() + groupStart + d->groupLen[next]);
+
+        uint64_t n = 0;
+        for (uint8_t i = 0; i < d->groupLen[next]; i = i + 1) {
+            uint8_t square = squares[groupStart + i];
+            auto adjust = (uint8_t)std::count_if(squares.begin(), squares.begin() + groupStart, [square](uint8_t other) {
+                return square > other;
+            });
+            n = n + this->binomial[i + 1][square - adjust - 8 * remainingPawns];
+        }
+
+        remainingPawns = false;
+        index = index + n * d->groupIdx[next];
+        groupStart = groupStart + d->groupLen[next];
+    }
+
+    return index;
+}
+int32_t Syzygy::decompressPairs(const PairsData& d, uint64_t index) {
+    if (d.flags & FLAG::SINGLE_VALUE) {
+        return d.minSymLen;
+    }
+
+    uint64_t k = index / d.span;
+    uint32_t block = readLE32(d.sparseIndex + 6 * k);
+    int32_t offset = readLE16(d.sparseIndex + 6 * k + 4);
+    offset = offset + (int32_t)(index % d.span) - (int32_t)(d.span / 2);
+
+    while (offset < 0) {
+        block = block - 1;
+        offset = offset + readLE16(d.blockLength + 2 * block) + 1;
+    }
+    while (offset > readLE16(d.blockLength + 2 * block)) {
+        offset = offset - readLE16(d.blockLength + 2 * block) - 1;
+        block = block + 1;
+    }
+
+    const uint8_t* ptr = d.data + (uint64_t)block * d.sizeofBlock;
+    uint64_t buf64 = readBE64(ptr);
+    ptr = ptr + 8;
+    int32_t buf64Size = 64;
+
+    uint16_t sym;
+    while (true) {
+        uint32_t length = 0;
+        while (buf64 < d.base64[length]) {
+            length = length + 1;
+        }
+        sym = (uint16_t)((buf64 - d.base64[length]) >> (64 - length - d.minSymLen));
+        sym = sym + readLE16(d.lowestSym + 2 * length);
+
+        if (offset < d.symlen[sym] + 1) {
+            break;
+        }
+        offset = offset - d.symlen[sym] - 1;
+
+        length = length + d.minSymLen;
+        buf64 = buf64 << length;
+        buf64Size = buf64Size - (int32_t)length;
+        if (buf64Size <= 32) {
+            buf64Size = buf64Size + 32;
+            buf64 = buf64 | ((uint64_t)readBE32(ptr) << (64 - buf64Size));
+            ptr = ptr + 4;
+        }
+    }
+
+    while (d.symlen[sym] != 0) {
+        uint16_t left = leftSymbol(d, sym);
+        if (offset < d.symlen[left] + 1) {
+            sym = left;
+        }
+        else {
+            offset = offset - d.symlen[left] - 1;
+            sym = rightSymbol(d, sym);
+        }
+    }
+
+    return leftSymbol(d, sym);
+}
+int32_t Syzygy::mapScore(Table& table, uint8_t tbFile, int32_t value, int8_t wdl) {
+    if (table.type == TABLE::WDL_TABLE) {
+        return value - 2;
+    }
+
+    static constexpr std::array<uint8_t, 5> WDL_MAP = {1, 3, 0, 2, 0};
+
+    const PairsData* d = table.get(0, tbFile);
+    if (d->flags & FLAG::MAPPED) {
+        uint16_t mapIndex = d->mapIdx[WDL_MAP[wdl + 2]];
+        if (d->flags & FLAG::WIDE) {
+            value = readLE16(table.map + 2 * (mapIndex + value));
+        }
+        else {
+            value = table.map[mapIndex + value];
+        }
+    }
+
+    if ((wdl == WDL::WIN and !(d->flags & FLAG::WIN_PLIES)) or (wdl == WDL::LOSS and !(d->flags & FLAG::LOSS_PLIES)) or wdl == WDL::CURSED_WIN or wdl == WDL::BLESSED_LOSS) {
+        value = value * 2;
+    }
+    return value + 1;
+}
+int8_t Syzygy::search(const Position& position, bool checkZeroingMoves, uint8_t& state) {
+    MoveList moves = LegalMoveGen::generate(position, position.getSide());
+    if (moves.getSize() == 0) {
+        state = STATE::OK;
+        return position.inCheck() ? WDL::LOSS : WDL::DRAW;
+    }
+
+    int8_t value;
+    int8_t bestValue = WDL::LOSS;
+    uint8_t moveCount = 0;
+
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+        if (!isCapture(move) and (!checkZeroingMoves or move.getAttackerType() != PIECE::PAWN)) {
+            continue;
+        }
+        moveCount = moveCount + 1;
+
+        Position copy = position;
+        copy.move(move);
+        value = (int8_t)-this->search(copy, false, state);
+
+        if (state == STATE::FAIL) {
+            return WDL::DRAW;
+        }
+        if (value > bestValue) {
+            bestValue = value;
+            if (value >= WDL::WIN) {
+                state = STATE::ZEROING_BEST_MOVE;
+                return value;
+            }
+        }
+    }
+
+    bool noMoreMoves = (moveCount == moves.getSize());
+    if (noMoreMoves) {
+        value = bestValue;
+    }
+    else {
+        value = (int8_t)this->probeTable(position, TABLE::WDL_TABLE, WDL::DRAW, state);
+        if (state == STATE::FAIL) {
+            return WDL::DRAW;
+        }
+    }
+
+    if (bestValue >= value) {
+        state = (bestValue > WDL::DRAW or noMoreMoves) ? STATE::ZEROING_BEST_MOVE : STATE::OK;
+        return bestValue;
+    }
+    state = STATE::OK;
+    return value;
+}
+int32_t Syzygy::probeDTZ(const Position& position, uint8_t& state) {
+    state = STATE::OK;
+    int8_t wdl = this->search(position, true, state);
+    if (state == STATE::FAIL or wdl == WDL::DRAW) {
+        return 0;
+    }
+    if (state == STATE::ZEROING_BEST_MOVE) {
+        return dtzBeforeZeroing(wdl);
+    }
+
+    int32_t sign = (wdl > 0) ? 1 : -1;
+    int32_t dtz = this->probeTable(position, TABLE::DTZ_TABLE, wdl, state);
+    if (state == STATE::FAIL) {
+        return 0;
+    }
+    if (state != STATE::CHANGE_STM) {
+        return (dtz + 100 * (wdl == WDL::BLESSED_LOSS or wdl == WDL::CURSED_WIN)) * sign;
+    }
+
+    int32_t minDTZ = 0xFFFF;
+    MoveList moves = LegalMoveGen::generate(position, position.getSide());
+    for (uint8_t i = 0; i < moves.getSize(); i = i + 1) {
+        Move move = moves[i];
+        bool zeroing = (isCapture(move) or move.getAttackerType() == PIECE::PAWN);
+
+        Position copy = position;
+        copy.move(move);
+        if (zeroing) {
+            dtz = -dtzBeforeZeroing(this->search(copy, false, state));
+        }
+        else {
+            dtz = -this->probeDTZ(copy, state);
+        }
+
+        if (dtz == 1 and copy.inCheck() and LegalMoveGen::generate(copy, copy.getSide()).getSize() == 0) {
+            minDTZ = 1;
+        }
+        if (!zeroing) {
+            dtz = dtz + (dtz > 0) - (dtz < 0);
+        }
+        if (dtz < minDTZ and (dtz > 0) == (sign > 0) and dtz != 0) {
+            minDTZ = dtz;
+        }
+
+        if (state == STATE::FAIL) {
+            return 0;
+        }
+    }
+
+    return (minDTZ == 0xFFFF) ? -1 : minDTZ;
+}
+int32_t Syzygy::dtzBeforeZeroing(int8_t wdl) {
+    switch (wdl) {
+    case WDL::WIN:
+        return 1;
+    case WDL::CURSED_WIN:
+        return 101;
+    case WDL::BLESSED_LOSS:
+        return -101;
+    case WDL::LOSS:
+        return -1;
+    default:
+        return 0;
+    }
+}
+std::string Syzygy::getName(const Position& position, bool mirrored) {
+    static constexpr std::array<uint8_t, 6> ORDER = {PIECE::KING, PIECE::QUEEN, PIECE::ROOK, PIECE::BISHOP, PIECE::KNIGHT, PIECE::PAWN};
+    static constexpr std::array<char, 6> LETTERS = {'K', 'Q', 'R', 'B', 'N', 'P'};
+
+    std::array<std::string, 2> sides;
+    for (uint8_t side = 0; side < 2; side = side + 1) {
+        for (uint8_t i = 0; i < 6; i = i + 1) {
+            sides[side].append(BOp::count1(position.getPieces().getPieceBitboard(side, ORDER[i])), LETTERS[i]);
+        }
+    }
+
+    if (mirrored) {
+        return sides[SIDE::BLACK] + "v" + sides[SIDE::WHITE];
+    }
+    return sides[SIDE::WHITE] + "v" + sides[SIDE::BLACK];
+}
+std::string Syzygy::canonicalName(const std::string& name) {
+    static const std::string STRENGTH = "KQRBNP";
+
+    size_t separator = name.find('v');
+    std::string first = name.substr(0, separator);
+    std::string second = name.substr(separator + 1);
+
+    bool swap = (second.size() > first.size());
+    if (first.size() == second.size()) {
+        for (size_t i = 0; i < first.size(); i = i + 1) {
+            if (first[i] != second[i]) {
+                swap = (STRENGTH.find(second[i]) < STRENGTH.find(first[i]));
+                break;
+            }
+        }
+    }
+
+    if (swap) {
+        return second + "v" + first;
+    }
+    return name;
+}
+uint8_t Syzygy::tbPiece(uint8_t type, uint8_t side) {
+    return (type + 1) | (side == SIDE::BLACK ? 8 : 0);
+}
+int32_t Syzygy::offA1H8(uint8_t square) {
+    return (int32_t)(square / 8) - (int32_t)(square % 8);
+}
+bool Syzygy::isCapture(Move move) {
+    return (move.getDefenderType() != Move::NONE or move.getFlag() == Move::FLAG::EN_PASSANT_CAPTURE);
+}
+uint16_t Syzygy::readLE16(const uint8_t* data) {
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+uint32_t Syzygy::readLE32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+uint32_t Syzygy::readBE32(const uint8_t* data) {
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+uint64_t Syzygy::readBE64(const uint8_t* data) {
+    return ((uint64_t)readBE32(data) << 32) | readBE32(data + 4);
+}
+Syzygy::Syzygy() {
+    this->largest = 0;
+    this->pieceLimit = MAX_PIECES;
+    this->probeDepth = 1;
+    this->hits = 0;
+
+    this->binomial = {};
+    this->binomial[0][0] = 1;
+    for (uint8_t n = 1; n < 64; n = n + 1) {
+        for (uint8_t k = 0; k < MAX_PIECES and k <= n; k = k + 1) {
+            this->binomial[k][n] = (k > 0 ? this->binomial[k - 1][n - 1] : 0) + (k < n ? this->binomial[k][n - 1] : 0);
+        }
+    }
+
+    this->mapB1H1H7 = {};
+    uint8_t code = 0;
+    for (uint8_t square = 0; square < 64; square = square + 1) {
+        if (offA1H8(square) < 0) {
+            this->mapB1H1H7[square] = code;
+            code = code + 1;
+        }
+    }
+
+    this->mapA1D1D4 = {};
+    std::vector<uint8_t> diagonal;
+    code = 0;
+    for (uint8_t square = 0; square <= 27; square = square + 1) {
+        if (offA1H8(square) < 0 and square % 8 <= 3) {
+            this->mapA1D1D4[square] = code;
+            code = code + 1;
+        }
+        else if (offA1H8(square) == 0 and square % 8 <= 3) {
+            diagonal.push_back(square);
+        }
+    }
+    for (uint8_t square : diagonal) {
+        this->mapA1D1D4[square] = code;
+        code = code + 1;
+    }
+
+    this->mapKK = {};
+    std::vector<std::pair<uint8_t, uint8_t>> bothOnDiagonal;
+    int32_t kkCode = 0;
+    for (uint8_t index = 0; index < 10; index = index + 1) {
+        for (uint8_t first = 0; first <= 27; first = first + 1) {
+            if (this->mapA1D1D4[first] != index or (index == 0 and first != 1)) {
+                continue;
+            }
+            for (uint8_t second = 0; second < 64; second = second + 1) {
+                if (first == second or BOp::getBit(KingMasks::MASKS[first], second)) {
+                    continue;
+                }
+                if (offA1H8(first) == 0 and offA1H8(second) > 0) {
+                    continue;
+                }
+                if (offA1H8(first) == 0 and offA1H8(second) == 0) {
+                    bothOnDiagonal.emplace_back(index, second);
+                    continue;
+                }
+                this->mapKK[index][second] = kkCode;
+                kkCode = kkCode + 1;
+            }
+        }
+    }
+    for (const auto& [index, second] : bothOnDiagonal) {
+        this->mapKK[index][second] = kkCode;
+        kkCode = kkCode + 1;
+    }
+
+    this->mapPawns = {};
+    this->leadPawnIdx = {};
+    this->leadPawnsSize = {};
+    uint8_t availableSquares = 47;
+    for (uint8_t leadPawnsCnt = 1; leadPawnsCnt <= 5; leadPawnsCnt = leadPawnsCnt + 1) {
+        for (uint8_t file = 0; file <= 3; file = file + 1) {
+            uint32_t index = 0;
+            for (uint8_t rank = 1; rank <= 6; rank = rank + 1) {
+                uint8_t square = rank * 8 + file;
+                if (leadPawnsCnt == 1) {
+                    this->mapPawns[square] = availableSquares;
+                    this->mapPawns[square ^ 7] = availableSquares - 1;
+                    availableSquares = availableSquares - 2;
+                }
+                this->leadPawnIdx[leadPawnsCnt][square] = index;
+                index = index + this->binomial[leadPawnsCnt - 1][this->mapPawns[square]];
+            }
+            this->leadPawnsSize[leadPawnsCnt][file] = index;
+        }
+    }
+}
\ No newline at end of file
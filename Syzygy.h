@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "LegalMoveGen.h"
+
+
+#pragma once
+
+
+class Syzygy {
+public:
+    static Syzygy* getPtr();
+    Syzygy(const Syzygy& donor) = delete;
+    ~Syzygy();
+
+    void setPath(const std::string& newPath);
+    void setProbeDepth(int32_t newProbeDepth);
+    void setPieceLimit(uint8_t newPieceLimit);
+
+    [[nodiscard]] uint8_t getCardinality() const;
+    [[nodiscard]] int32_t getProbeDepth() const;
+    [[nodiscard]] uint64_t getHits() const;
+    void resetHits();
+
+    [[nodiscard]] bool canProbe(const Position& position) const;
+    [[nodiscard]] bool canProbe(const Position& position, int32_t depthLeft) const;
+    int8_t probeWDL(const Position& position, bool& success);
+    int32_t probeDTZ(const Position& position, bool& success);
+    bool filterRootMoves(const Position& position, MoveList& moves, int8_t& wdl);
+
+    enum WDL {
+        LOSS = -2,
+        BLESSED_LOSS = -1,
+        DRAW = 0,
+        CURSED_WIN = 1,
+        WIN = 2
+    };
+
+    static constexpr uint8_t MAX_PIECES = 7;
+private:
+    Syzygy();
+
+    enum TABLE {
+        WDL_TABLE,
+        DTZ_TABLE
+    };
+    enum STATE {
+        FAIL,
+        OK,
+        CHANGE_STM,
+        ZEROING_BEST_MOVE
+    };
+    enum FLAG {
+        STM = 1,
+        MAPPED = 2,
+        WIN_PLIES = 4,
+        LOSS_PLIES = 8,
+        WIDE = 16,
+        SINGLE_VALUE = 128
+    };
+
+    struct PairsData {
+        uint8_t flags;
+        uint64_t sizeofBlock;
+        uint64_t span;
+        uint32_t numBlocks;
+        uint8_t maxSymLen;
+        uint8_t minSymLen;
+        const uint8_t* lowestSym;
+        const uint8_t* btree;
+        const uint8_t* blockLength;
+        uint32_t blockLengthSize;
+        const uint8_t* sparseIndex;
+        uint64_t sparseIndexSize;
+        const uint8_t* data;
+        std::vector<uint64_t> base64;
+        std::vector<uint8_t> symlen;
+        std::array<uint8_t, MAX_PIECES> pieces;
+        std::array<uint64_t, MAX_PIECES + 1> groupIdx;
+        std::array<uint8_t, MAX_PIECES + 1> groupLen;
+        std::array<uint16_t, 4> mapIdx;
+    };
+    struct Table {
+        std::string name;
+        std::string mirroredName;
+        uint8_t type;
+        bool hasPawns;
+        bool hasUniquePieces;
+        uint8_t pieceCount;
+        std::array<uint8_t, 2> pawnCount;
+        std::array<std::array<PairsData, 4>, 2> items;
+        const uint8_t* map;
+
+        const uint8_t* base;
+        uint64_t size;
+#ifdef _WIN32
+        void* file;
+        void* mapping;
+#else
+        int32_t file;
+#endif
+
+        PairsData* get(uint8_t stm, uint8_t tbFile);
+    };
+
+    [[nodiscard]] std::string getPath(const std::string& name, uint8_t type) const;
+    static void initTable(Table& table, const std::string& name, uint8_t type);
+    Table* getTable(const Position& position, uint8_t type);
+    bool mapTable(Table& table);
+    static void unmapTable(Table& table);
+
+    bool setup(Table& table);
+    void setGroups(Table& table, PairsData& d, const std::array<uint8_t, 2>& order, uint8_t tbFile) const;
+    static const uint8_t* setSizes(PairsData& d, const uint8_t* data);
+    static uint8_t setSymlen(PairsData& d, uint16_t sym, std::vector<bool>& visited);
+    static uint16_t leftSymbol(const PairsData& d, uint16_t sym);
+    static uint16_t rightSymbol(const PairsData& d, uint16_t sym);
+    static const uint8_t* setDtzMap(Table& table, const uint8_t* data, const uint8_t* base, uint8_t maxFile);
+
+    int32_t probeTable(const Position& position, uint8_t type, int8_t wdl, uint8_t& state);
+    int32_t doProbeTable(const Position& position, Table& table, int8_t wdl, uint8_t& state) const;
+    uint64_t getIndex(const Position& position, Table& table, uint8_t& stm, uint8_t& tbFile) const;
+    static int32_t decompressPairs(const PairsData& d, uint64_t index);
+    static int32_t mapScore(Table& table, uint8_t tbFile, int32_t value, int8_t wdl);
+
+    int8_t search(const Position& position, bool checkZeroingMoves, uint8_t& state);
+    int32_t probeDTZ(const Position& position, uint8_t& state);
+    static int32_t dtzBeforeZeroing(int8_t wdl);
+
+    static std::string getName(const Position& position, bool mirrored);
+    static std::string canonicalName(const std::string& name);
+    static uint8_t tbPiece(uint8_t type, uint8_t side);
+    static int32_t offA1H8(uint8_t square);
+    static bool isCapture(Move move);
+
+    static uint16_t readLE16(const uint8_t* data);
+    static uint32_t readLE32(const uint8_t* data);
+    static uint32_t readBE32(const uint8_t* data);
+    static uint64_t readBE64(const uint8_t* data);
+
+    static Syzygy* syzygy;
+
+    std::array<std::array<uint64_t, 64>, MAX_PIECES> binomial;
+    std::array<uint8_t, 64> mapPawns;
+    std::array<std::array<uint32_t, 64>, 6> leadPawnIdx;
+    std::array<std::array<uint32_t, 4>, 6> leadPawnsSize;
+    std::array<uint8_t, 64> mapB1H1H7;
+    std::array<uint8_t, 64> mapA1D1D4;
+    std::array<std::array<int32_t, 64>, 10> mapKK;
+
+    std::string path;
+    std::array<std::unordered_set<std::string>, 2> available;
+    std::array<std::unordered_map<std::string, std::unique_ptr<Table>>, 2> tables;
+    std::mutex mutex;
+
+    uint8_t largest;
+    uint8_t pieceLimit;
+    int32_t probeDepth;
+    std::atomic<uint64_t> hits;
+
+    static constexpr std::array<const char*, 2> EXTENSIONS = {".rtbw", ".rtbz"};
+    static constexpr std::array<std::array<uint8_t, 4>, 2> MAGICS = {{{0x71, 0xE8, 0x23, 0x5D}, {0xD7, 0x66, 0x0C, 0xA5}}};
+};
\ No newline at end of file
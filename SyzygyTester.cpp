@@ -0,0 +1,52 @@
+#include "SyzygyTester.h"
+
+void SyzygyTester::runTests(const std::string& path) {
+    Syzygy::getPtr()->setPath(path);
+    if (Syzygy::getPtr()->getCardinality() < 3) {
+        std::cout << "No tablebases found in " << path << ". Skipped." << std::endl;
+        return;
+    }
+
+    std::array<Test, 10> tests = {{
+        {"8/8/8/8/8/8/3k4/KR6", SIDE::BLACK, Syzygy::WDL::LOSS, -30, 2},
+        {"8/8/8/8/8/8/5k2/KR6", SIDE::BLACK, Syzygy::WDL::LOSS, -26, 1},
+        {"8/8/8/3k4/8/8/8/KR6", SIDE::BLACK, Syzygy::WDL::LOSS, -30, 5},
+        {"8/8/8/3k4/8/8/8/KR6", SIDE::WHITE, Syzygy::WDL::WIN, 29, 2},
+        {"8/8/8/8/4k3/8/8/R3K3", SIDE::WHITE, Syzygy::WDL::WIN, 25, 1},
+        {"8/8/8/8/4k3/8/8/R3K3", SIDE::BLACK, Syzygy::WDL::LOSS, -28, 5},
+        {"8/8/8/8/8/2k5/8/R3K3", SIDE::WHITE, Syzygy::WDL::WIN, 21, 1},
+        {"4k3/8/4K3/8/8/8/8/7R", SIDE::BLACK, Syzygy::WDL::LOSS, -4, 2},
+        {"7k/8/6K1/8/8/8/8/R7", SIDE::BLACK, Syzygy::WDL::LOSS, -2, 1},
+        {"8/8/8/8/8/8/1k6/1R5K", SIDE::BLACK, Syzygy::WDL::DRAW, 0, 1}
+    }};
+    for (const auto& test : tests) {
+        runTest(test);
+    }
+    std::cout << std::endl;
+}
+void SyzygyTester::runTest(const Test& test) {
+    auto position = Position(test.shortFen, Position::NONE, false, false, false, false, test.side, 0, 1);
+    Syzygy* syzygy = Syzygy::getPtr();
+
+    bool wdlSuccess;
+    bool dtzSuccess;
+    int8_t wdl = syzygy->probeWDL(position, wdlSuccess);
+    int32_t dtz = syzygy->probeDTZ(position, dtzSuccess);
+
+    MoveList moves = LegalMoveGen::generate(position, test.side);
+    uint8_t legal = moves.getSize();
+    int8_t rootWdl;
+    bool filtered = syzygy->filterRootMoves(position, moves, rootWdl);
+
+    bool correct = wdlSuccess and dtzSuccess and filtered and wdl == test.wdl and rootWdl == test.wdl;
+    correct = correct and dtz == test.dtz and moves.getSize() == test.rootMoves;
+
+    std::cout << std::setw(24) << test.shortFen << (test.side == SIDE::WHITE ? " w" : " b") << ". Correct DTZ: " << std::setw(4) << test.dtz << ". Got: " << std::setw(4) << dtz << ". Root moves: " << std::setw(2) << (uint32_t)moves.getSize() << " of " << std::setw(2) << (uint32_t)legal;
+    if (correct) {
+        std::cout << ". OK." << std::endl;
+    }
+    else {
+        std::cout << ". Error." << std::endl;
+        std::terminate();
+    }
+}
\ No newline at end of file
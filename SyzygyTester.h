@@ -0,0 +1,22 @@
+#include <iomanip>
+#include <iostream>
+#include "Syzygy.h"
+
+
+#pragma once
+
+
+class SyzygyTester {
+public:
+    static void runTests(const std::string& path);
+private:
+    struct Test {
+        std::string shortFen;
+        uint8_t side;
+        int8_t wdl;
+        int32_t dtz;
+        uint8_t rootMoves;
+    };
+
+    static void runTest(const Test& test);
+};
\ No newline at end of file
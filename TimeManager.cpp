@@ -0,0 +1,61 @@
+#include "TimeManager.h"
+
+
+
+TimeManager::TimeManager(int32_t moveTime) {
+    this->start = std::chrono::steady_clock::now();
+    this->hardLimit = std::max(moveTime, 1);
+    this->softLimit = std::max(moveTime / 2, 1);
+    this->stability = 0;
+    this->unlimited = false;
+}
+TimeManager::TimeManager(int32_t time, int32_t increment, int32_t movesToGo) {
+    if (movesToGo <= 0) {
+        movesToGo = MOVES_TO_GO;
+    }
+    int32_t available = std::max(time - OVERHEAD, 1);
+
+    this->start = std::chrono::steady_clock::now();
+    this->softLimit = std::min(time / movesToGo + increment * 3 / 4, available);
+    this->hardLimit = std::min(std::max(this->softLimit * 4, time / 4 + increment), available);
+    this->softLimit = std::max(std::min(this->softLimit, this->hardLimit), 1);
+    this->stability = 0;
+    this->unlimited = false;
+}
+void TimeManager::update(Move newBestMove) {
+    if (newBestMove == this->bestMove) {
+        this->stability = this->stability + 1;
+    }
+    else {
+        this->bestMove = newBestMove;
+        this->stability = 0;
+    }
+}
+void TimeManager::setInfinite(bool newInfinite) {
+    this->unlimited.store(newInfinite, std::memory_order_relaxed);
+}
+bool TimeManager::infinite() const {
+    return this->unlimited.load(std::memory_order_relaxed);
+}
+int64_t TimeManager::getElapsed() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->start).count();
+}
+int32_t TimeManager::getSoftLimit() const {
+    return this->softLimit;
+}
+int32_t TimeManager::getHardLimit() const {
+    return this->hardLimit;
+}
+bool TimeManager::softLimitReached() const {
+    if (this->infinite()) {
+        return false;
+    }
+    int32_t percent = std::max(150 - 25 * this->stability, 50);
+    return (this->getElapsed() * 100 >= (int64_t)this->softLimit * percent);
+}
+bool TimeManager::hardLimitReached() const {
+    if (this->infinite()) {
+        return false;
+    }
+    return (this->getElapsed() >= this->hardLimit);
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include "Move.h"
+
+
+#pragma once
+
+
+class TimeManager {
+public:
+    explicit TimeManager(int32_t moveTime);
+    TimeManager(int32_t time, int32_t increment, int32_t movesToGo = 0);
+
+    void update(Move bestMove);
+    void setInfinite(bool newInfinite);
+
+    [[nodiscard]] bool infinite() const;
+    [[nodiscard]] int64_t getElapsed() const;
+    [[nodiscard]] int32_t getSoftLimit() const;
+    [[nodiscard]] int32_t getHardLimit() const;
+    [[nodiscard]] bool softLimitReached() const;
+    [[nodiscard]] bool hardLimitReached() const;
+
+    static constexpr int32_t MOVES_TO_GO = 30;
+    static constexpr int32_t OVERHEAD = 30;
+private:
+    std::chrono::steady_clock::time_point start;
+    int32_t softLimit;
+    int32_t hardLimit;
+
+    Move bestMove;
+    int32_t stability;
+
+    std::atomic<bool> unlimited;
+};
\ No newline at end of file
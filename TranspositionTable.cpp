@@ -1,30 +1,32 @@
-#include "TranspositionTable.h"
-
-TranspositionTable* TranspositionTable::table = nullptr;
-
-
-
-TranspositionTable* TranspositionTable::getPtr() {
-    if (table == nullptr) {
-        table = new TranspositionTable();
-    }
-    return table;
-}
-void TranspositionTable::addEntry(ZobristHash hash, int32_t depth, uint8_t bestMoveIndex) {
-    auto it = this->map.find(hash.getValue());
-    if (it == this->map.end()) {
-        this->map[hash.getValue()] = std::make_pair(depth, bestMoveIndex);
-    }
-    else if (it->second.first < depth) {
-        this->map.erase(it);
-        this->map[hash.getValue()] = std::make_pair(depth, bestMoveIndex);
-    }
-}
-uint8_t TranspositionTable::getBestMoveIndex(ZobristHash hash) const {
-    auto it = this->map.find(hash.getValue());
-    if (it == this->map.end()) {
-        return NONE;
-    }
-    return it->second.second;
-}
+#include "TranspositionTable.h"
+
+TranspositionTable* TranspositionTable::table = nullptr;
+
+
+
+TranspositionTable* TranspositionTable::getPtr() {
+    if (table == nullptr) {
+        table = new TranspositionTable();
+    }
+    return table;
+}
+void TranspositionTable::addEntry(ZobristHash hash, int32_t depth, int32_t score, uint8_t bound, Move move) {
+    auto it = this->map.find(hash.getValue());
+    if (it == this->map.end()) {
+        if (this->map.size() >= MAX_ENTRIES) {
+            this->map.clear();
+        }
+        this->map[hash.getValue()] = {depth, score, bound, move};
+    }
+    else if (it->second.depth <= depth) {
+        it->second = {depth, score, bound, move};
+    }
+}
+TranspositionTable::Entry TranspositionTable::getEntry(ZobristHash hash) const {
+    auto it = this->map.find(hash.getValue());
+    if (it == this->map.end()) {
+        return {0, 0, NONE, Move()};
+    }
+    return it->second;
+}
 TranspositionTable::TranspositionTable() = default;
\ No newline at end of file
@@ -1,23 +1,37 @@
-#include <unordered_map>
-#include "ZobristHash.h"
-
-
-#pragma once
-
-
-class TranspositionTable {
-public:
-    static TranspositionTable* getPtr();
-    TranspositionTable(const TranspositionTable& donor) = delete;
-
-    void addEntry(ZobristHash hash, int32_t depth, uint8_t bestMoveIndex);
-    [[nodiscard]] uint8_t getBestMoveIndex(ZobristHash hash) const;
-
-    static constexpr uint8_t NONE = 255;
-private:
-    TranspositionTable();
-
-    static TranspositionTable* table;
-
-    std::unordered_map<uint64_t, std::pair<int32_t, uint8_t>> map;
+#include <unordered_map>
+#include "ZobristHash.h"
+#include "Move.h"
+
+
+#pragma once
+
+
+class TranspositionTable {
+public:
+    static TranspositionTable* getPtr();
+    TranspositionTable(const TranspositionTable& donor) = delete;
+
+    enum BOUND {
+        EXACT,
+        LOWER,
+        UPPER
+    };
+    struct Entry {
+        int32_t depth;
+        int32_t score;
+        uint8_t bound;
+        Move move;
+    };
+
+    void addEntry(ZobristHash hash, int32_t depth, int32_t score, uint8_t bound, Move move);
+    [[nodiscard]] Entry getEntry(ZobristHash hash) const;
+
+    static constexpr uint8_t NONE = 255;
+    static constexpr size_t MAX_ENTRIES = 1 << 21;
+private:
+    TranspositionTable();
+
+    static TranspositionTable* table;
+
+    std::unordered_map<uint64_t, Entry> map;
 };
\ No newline at end of file
@@ -1,878 +1,1244 @@
-#include "ChessEngine.h"
-#include <QDebug>
-#include <QTimer>
-
-ChessEngine::ChessEngine(QObject *parent)
-    : QObject(parent),
-    selectedPiece(QPoint(-1, -1)),
-    currentStatus(STATUS::WHITE_TO_MOVE),
-    gameMode(GameMode::TwoPlayers),
-    m_difficulty(2), // По умолчанию средняя сложность
-    hasLastMoveInfo(false)
-{
-    // Загружаем сохраненные партии при запуске
-    loadSavedGames();
-
-    // Стартуем новую партию
-    startNewGame();
-}
-
-void ChessEngine::startNewGame()
-{
-    // Инициализация позиции на шахматной доске
-    position = Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
-                        Position::NONE, true, true, true, true, 1);
-    selectedPiece = QPoint(-1, -1);
-    currentStatus = STATUS::WHITE_TO_MOVE;
-
-    // Очищаем историю ходов и последний ход
-    moveHistory.clear();
-    hasLastMoveInfo = false;
-
-    emit piecesChanged();
-    emit statusChanged();
-    emit canUndoChanged();
-    emit vsComputerEnabled();
-    emit lastMoveChanged();
-}
-
-void ChessEngine::setGameMode(const QString& mode)
-{
-    if (mode == "twoPlayers") {
-        gameMode = GameMode::TwoPlayers;
-    } else if (mode == "vsComputer") {
-        gameMode = GameMode::VsComputer;
-    }
-}
-
-QVariantList ChessEngine::getPieces() const
-{
-    QVariantList piecesList;
-    Pieces pieces = position.getPieces();
-
-    for (int y = 0; y < 8; y++) {
-        for (int x = 0; x < 8; x++) {
-            int index = y * 8 + x;
-            QString pieceName;
-
-            if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN), index))
-                pieceName = "whitePawn";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KNIGHT), index))
-                pieceName = "whiteKnight";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::BISHOP), index))
-                pieceName = "whiteBishop";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::ROOK), index))
-                pieceName = "whiteRook";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::QUEEN), index))
-                pieceName = "whiteQueen";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING), index))
-                pieceName = "whiteKing";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN), index))
-                pieceName = "blackPawn";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KNIGHT), index))
-                pieceName = "blackKnight";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::BISHOP), index))
-                pieceName = "blackBishop";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::ROOK), index))
-                pieceName = "blackRook";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::QUEEN), index))
-                pieceName = "blackQueen";
-            else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING), index))
-                pieceName = "blackKing";
-            else
-                continue;
-
-            QVariantMap piece;
-            piece["x"] = x;
-            piece["y"] = y;
-            piece["type"] = pieceName;
-            piecesList.append(piece);
-        }
-    }
-
-    return piecesList;
-}
-
-QString ChessEngine::getTextureName(int x, int y) const
-{
-    int index = y * 8 + x;
-    Pieces pieces = position.getPieces();
-
-    if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::PAWN), index))
-        return "whitePawn";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KNIGHT), index))
-        return "whiteKnight";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::BISHOP), index))
-        return "whiteBishop";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::ROOK), index))
-        return "whiteRook";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::QUEEN), index))
-        return "whiteQueen";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::WHITE, PIECE::KING), index))
-        return "whiteKing";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::PAWN), index))
-        return "blackPawn";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KNIGHT), index))
-        return "blackKnight";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::BISHOP), index))
-        return "blackBishop";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::ROOK), index))
-        return "blackRook";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::QUEEN), index))
-        return "blackQueen";
-    else if (BOp::getBit(pieces.getPieceBitboard(SIDE::BLACK, PIECE::KING), index))
-        return "blackKing";
-
-    return "";
-}
-
-QVariantList ChessEngine::getLegalMovesForPiece(int x, int y) const
-{
-    QVariantList moves;
-    int from = y * 8 + x;
-
-    // Получаем ходы только для фигур текущего игрока
-    Pieces pieces = position.getPieces();
-    if ((currentStatus == STATUS::WHITE_TO_MOVE &&
-         !BOp::getBit(pieces.getSideBitboard(SIDE::WHITE), from)) ||
-        (currentStatus == STATUS::BLACK_TO_MOVE &&
-         !BOp::getBit(pieces.getSideBitboard(SIDE::BLACK), from))) {
-        return moves;
-    }
-
-    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
-    MoveList legalMoves = LegalMoveGen::generate(position, side);
-
-    for (uint8_t i = 0; i < legalMoves.getSize(); i++) {
-        Move move = legalMoves[i];
-        if (move.getFrom() == from) {
-            int toX = move.getTo() % 8;
-            int toY = move.getTo() / 8;
-            QVariantMap moveMap;
-            moveMap["x"] = toX;
-            moveMap["y"] = toY;
-            moves.append(moveMap);
-        }
-    }
-
-    return moves;
-}
-
-void ChessEngine::recordMove(int fromX, int fromY, int toX, int toY)
-{
-    MoveHistoryItem item;
-    item.position = position;  // Сохраняем положение до хода
-    item.moveFrom = QPoint(fromX, fromY);
-    item.moveTo = QPoint(toX, toY);
-    moveHistory.push(item);
-
-    // Обновляем информацию о последнем ходе
-    setLastMove(fromX, fromY, toX, toY);
-
-    emit canUndoChanged();
-    emit vsComputerEnabled();
-}
-
-void ChessEngine::setLastMove(int fromX, int fromY, int toX, int toY)
-{
-    lastMoveFrom = QPoint(fromX, fromY);
-    lastMoveTo = QPoint(toX, toY);
-    hasLastMoveInfo = true;
-
-    qDebug() << "Last move set: " << fromX << "," << fromY << " to " << toX << "," << toY;
-
-    emit lastMoveChanged();
-}
-
-bool ChessEngine::processMove(int fromX, int fromY, int toX, int toY)
-{
-    if (currentStatus != STATUS::WHITE_TO_MOVE &&
-        currentStatus != STATUS::BLACK_TO_MOVE) {
-        return false;
-    }
-
-    // В режиме игры с компьютером, игрок может ходить только белыми
-    if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
-        return false;
-    }
-
-    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
-    uint8_t from = fromY * 8 + fromX;
-    uint8_t to = toY * 8 + toX;
-
-    MoveList moves = LegalMoveGen::generate(position, side);
-    int moveIndex = -1;
-    bool isPawnPromotion = false;
-
-
-    bool isWhitePawnPromotion = (side == SIDE::WHITE && toY == 7 &&
-                                 BOp::getBit(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::PAWN), from));
-    bool isBlackPawnPromotion = (side == SIDE::BLACK && toY == 0 &&
-                                 BOp::getBit(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::PAWN), from));
-
-    if (isWhitePawnPromotion || isBlackPawnPromotion) {
-        // Просто проверяем, что такой ход возможен (без учета типа превращения)
-        for (uint8_t i = 0; i < moves.getSize(); i++) {
-            Move move = moves[i];
-            if (move.getFrom() == from && move.getTo() == to &&
-                (move.getFlag() == Move::FLAG::PROMOTE_TO_QUEEN ||
-                 move.getFlag() == Move::FLAG::PROMOTE_TO_ROOK ||
-                 move.getFlag() == Move::FLAG::PROMOTE_TO_BISHOP ||
-                 move.getFlag() == Move::FLAG::PROMOTE_TO_KNIGHT)) {
-                isPawnPromotion = true;
-                // Сохраняем позицию до превращения
-                recordMove(fromX, fromY, toX, toY);
-                // Мы нашли допустимый ход превращения пешки, но не выполняем его сейчас
-                // Вместо этого запрашиваем у пользователя тип фигуры
-                emit pawnPromotion(fromX, fromY, toX, toY);
-                return true; // Возвращаем true, чтобы показать, что ход будет обработан позже
-            }
-        }
-    }
-
-    // Если это не превращение пешки, продолжаем как обычно
-    if (!isPawnPromotion) {
-        for (uint8_t i = 0; i < moves.getSize(); i++) {
-            Move move = moves[i];
-            if (move.getFrom() == from && move.getTo() == to) {
-                moveIndex = i;
-                break;
-            }
-        }
-    }
-
-    if (moveIndex != -1) {
-        Move selectedMove = moves[moveIndex];
-
-        // Записываем ход в историю перед его выполнением
-        recordMove(fromX, fromY, toX, toY);
-
-        position.move(selectedMove);
-        updateStatus();
-        emit piecesChanged();
-        emit statusChanged();
-
-        if (currentStatus == STATUS::WHITE_WON ||
-            currentStatus == STATUS::BLACK_WON ||
-            currentStatus == STATUS::DRAW) {
-            QString result;
-            if (currentStatus == STATUS::WHITE_WON) {
-                result = "Белые победили!";
-            } else if (currentStatus == STATUS::BLACK_WON) {
-                result = "Чёрные победили!";
-            } else {
-                result = "Ничья!";
-            }
-            emit gameEnded(result);
-        }
-        // Если режим игры с компьютером и сейчас ход черных, компьютер делает ход
-        else if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
-            QTimer::singleShot(500, this, &ChessEngine::makeAIMove);
-        }
-
-        return true;
-    }
-
-    return false;
-}
-
-bool ChessEngine::promotePawn(int fromX, int fromY, int toX, int toY, const QString& pieceType)
-{
-    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
-    uint8_t from = fromY * 8 + fromX;
-    uint8_t to = toY * 8 + toX;
-
-    MoveList moves = LegalMoveGen::generate(position, side);
-    int moveIndex = -1;
-
-    // Определяем флаг превращения в зависимости от выбранного типа фигуры
-    Move::FLAG promotionFlag;
-    if (pieceType == "queen") {
-        promotionFlag = Move::FLAG::PROMOTE_TO_QUEEN;
-    } else if (pieceType == "rook") {
-        promotionFlag = Move::FLAG::PROMOTE_TO_ROOK;
-    } else if (pieceType == "bishop") {
-        promotionFlag = Move::FLAG::PROMOTE_TO_BISHOP;
-    } else if (pieceType == "knight") {
-        promotionFlag = Move::FLAG::PROMOTE_TO_KNIGHT;
-    } else {
-        // По умолчанию превращаем в ферзя
-        promotionFlag = Move::FLAG::PROMOTE_TO_QUEEN;
-    }
-
-    // Находим ход с соответствующим флагом
-    for (uint8_t i = 0; i < moves.getSize(); i++) {
-        Move move = moves[i];
-        if (move.getFrom() == from && move.getTo() == to && move.getFlag() == promotionFlag) {
-            moveIndex = i;
-            break;
-        }
-    }
-
-    if (moveIndex != -1) {
-        Move selectedMove = moves[moveIndex];
-
-        position.move(selectedMove);
-        updateStatus();
-        emit piecesChanged();
-        emit statusChanged();
-
-        if (currentStatus == STATUS::WHITE_WON ||
-            currentStatus == STATUS::BLACK_WON ||
-            currentStatus == STATUS::DRAW) {
-            QString result;
-            if (currentStatus == STATUS::WHITE_WON) {
-                result = "Белые победили!";
-            } else if (currentStatus == STATUS::BLACK_WON) {
-                result = "Чёрные победили!";
-            } else {
-                result = "Ничья!";
-            }
-            emit gameEnded(result);
-        }
-        // Если режим игры с компьютером и сейчас ход черных, компьютер делает ход
-        else if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
-            QTimer::singleShot(500, this, &ChessEngine::makeAIMove);
-        }
-
-        return true;
-    }
-
-    return false;
-}
-
-void ChessEngine::updateStatus()
-{
-    currentStatus = static_cast<STATUS>(getStatus());
-}
-
-QString ChessEngine::status() const
-{
-    return statusToString();
-}
-
-QString ChessEngine::statusToString() const
-{
-    switch (currentStatus) {
-    case STATUS::WHITE_TO_MOVE: return "Ход белых";
-    case STATUS::BLACK_TO_MOVE: return "Ход чёрных";
-    case STATUS::WHITE_WON: return "Белые выиграли";
-    case STATUS::BLACK_WON: return "Чёрные выиграли";
-    case STATUS::DRAW: return "Ничья";
-    }
-    return "Неизвестно";
-}
-
-uint8_t ChessEngine::getStatus() const
-{
-    if (position.fiftyMovesRuleDraw() || position.threefoldRepetitionDraw()) {
-        return STATUS::DRAW;
-    }
-
-    if (!position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::PAWN) &&
-        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::PAWN) &&
-        !position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::ROOK) &&
-        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::ROOK) &&
-        !position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::QUEEN) &&
-        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::QUEEN) &&
-        BOp::count1(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::KNIGHT) |
-                    position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::BISHOP)) < 2 &&
-        BOp::count1(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::KNIGHT) |
-                    position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::BISHOP)) < 2) {
-        return STATUS::DRAW;
-    }
-
-    if (position.whiteToMove()) {
-        MoveList whiteMoves = LegalMoveGen::generate(position, SIDE::WHITE);
-        if (whiteMoves.getSize() == 0) {
-            bool whiteInCheck = PsLegalMoveMaskGen::inDanger(
-                position.getPieces(),
-                BOp::bsf(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::KING)),
-                SIDE::WHITE
-                );
-            return whiteInCheck ? STATUS::BLACK_WON : STATUS::DRAW;
-        }
-        return STATUS::WHITE_TO_MOVE;
-    } else {
-        MoveList blackMoves = LegalMoveGen::generate(position, SIDE::BLACK);
-        if (blackMoves.getSize() == 0) {
-            bool blackInCheck = PsLegalMoveMaskGen::inDanger(
-                position.getPieces(),
-                BOp::bsf(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::KING)),
-                SIDE::BLACK
-                );
-            return blackInCheck ? STATUS::WHITE_WON : STATUS::DRAW;
-        }
-        return STATUS::BLACK_TO_MOVE;
-    }
-}
-
-bool ChessEngine::undoLastMove()
-{
-    if (moveHistory.isEmpty()) {
-        return false;
-    }
-
-    MoveHistoryItem lastMove = moveHistory.pop();
-    position = lastMove.position;
-
-    // Обновляем последний ход для визуализации
-    if (!moveHistory.isEmpty()) {
-        MoveHistoryItem prevMove = moveHistory.top();
-        lastMoveFrom = prevMove.moveFrom;
-        lastMoveTo = prevMove.moveTo;
-        hasLastMoveInfo = true;
-    } else {
-        hasLastMoveInfo = false;
-    }
-
-    updateStatus();
-    emit piecesChanged();
-    emit canUndoChanged();
-    emit vsComputerEnabled();
-    emit lastMoveChanged();
-    emit statusChanged();
-
-    return true;
-}
-
-bool ChessEngine::canUndo() const
-{
-    return !moveHistory.isEmpty();
-}
-
-bool ChessEngine::vsComputer() const
-{
-    return gameMode == GameMode::VsComputer;
-}
-
-QPoint ChessEngine::getLastMoveFrom() const
-{
-    return lastMoveFrom;
-}
-
-QPoint ChessEngine::getLastMoveTo() const
-{
-    return lastMoveTo;
-}
-
-bool ChessEngine::hasLastMove() const
-{
-    return hasLastMoveInfo;
-}
-
-int ChessEngine::difficulty() const
-{
-    return m_difficulty;
-}
-
-void ChessEngine::setDifficulty(int newDifficulty)
-{
-    if (newDifficulty < 1)
-        newDifficulty = 1;
-    else if (newDifficulty > 3)
-        newDifficulty = 3;
-
-    if (m_difficulty != newDifficulty) {
-        m_difficulty = newDifficulty;
-        emit difficultyChanged();
-    }
-}
-
-QString ChessEngine::getDifficultyName() const
-{
-    switch (m_difficulty) {
-    case 1: return "Легкий";
-    case 2: return "Средний";
-    case 3: return "Сложный";
-    default: return "Средний";
-    }
-}
-
-void ChessEngine::makeAIMove()
-{
-    if (currentStatus != STATUS::BLACK_TO_MOVE) {
-        return;
-    }
-
-
-    int thinkingTime;
-    switch (m_difficulty) {
-    case 1: // Легкий
-        thinkingTime = 500; // 0.5 секунд
-        break;
-    case 2: // Средний
-        thinkingTime = 1000; // 1 секунда
-        break;
-    case 3: // Сложный
-        thinkingTime = 2000; // 2 секунды
-        break;
-    default:
-        thinkingTime = 1000;
-    }
-
-    // AI делает ход с учетом сложности
-    Move aiMove = AI::getBestMove(position, SIDE::BLACK, thinkingTime);
-
-    int fromX = aiMove.getFrom() % 8;
-    int fromY = aiMove.getFrom() / 8;
-    int toX = aiMove.getTo() % 8;
-    int toY = aiMove.getTo() / 8;
-
-
-    recordMove(fromX, fromY, toX, toY);
-
-
-    position.move(aiMove);
-    updateStatus();
-
-
-    emit piecesChanged();
-    emit statusChanged();
-
-    // Проверка на конец игры
-    if (currentStatus == STATUS::WHITE_WON ||
-        currentStatus == STATUS::BLACK_WON ||
-        currentStatus == STATUS::DRAW) {
-        QString result;
-        if (currentStatus == STATUS::WHITE_WON) {
-            result = "Белые победили!";
-        } else if (currentStatus == STATUS::BLACK_WON) {
-            result = "Чёрные победили!";
-        } else {
-            result = "Ничья!";
-        }
-        emit gameEnded(result);
-    }
-}
-
-
-bool ChessEngine::saveGame(const QString& name)
-{
-
-    if (savedGames.size() >= 3) {
-        return false;
-    }
-
-    SavedGame game;
-    game.name = name;
-    game.date = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm");
-    game.gameMode = (gameMode == GameMode::TwoPlayers) ? "twoPlayers" : "vsComputer";
-    game.difficulty = m_difficulty;
-    game.status = statusToString();
-    game.fen = serializePosition(position);
-
-
-    for (const MoveHistoryItem& item : moveHistory) {
-        game.moveFromHistory.append(item.moveFrom);
-        game.moveToHistory.append(item.moveTo);
-    }
-
-
-    savedGames.append(game);
-    saveSavedGames();
-    emit savedGamesChanged();
-
-    return true;
-}
-
-
-bool ChessEngine::loadGame(int slot)
-{
-    if (slot < 0 || slot >= savedGames.size()) {
-        return false;
-    }
-
-    const SavedGame& game = savedGames[slot];
-
-
-    if (game.gameMode == "twoPlayers") {
-        gameMode = GameMode::TwoPlayers;
-    } else {
-        gameMode = GameMode::VsComputer;
-    }
-
-
-    m_difficulty = game.difficulty;
-
-
-    position = deserializePosition(game.fen);
-
-
-    moveHistory.clear();
-
-    for (int i = 0; i < game.moveFromHistory.size(); i++) {
-        MoveHistoryItem item;
-        item.moveFrom = game.moveFromHistory[i];
-        item.moveTo = game.moveToHistory[i];
-
-        moveHistory.push(item);
-    }
-
-
-    if (!game.moveFromHistory.isEmpty()) {
-        lastMoveFrom = game.moveFromHistory.last();
-        lastMoveTo = game.moveToHistory.last();
-        hasLastMoveInfo = true;
-    } else {
-        hasLastMoveInfo = false;
-    }
-
-
-    updateStatus();
-
-
-    emit piecesChanged();
-    emit statusChanged();
-    emit difficultyChanged();
-    emit canUndoChanged();
-    emit vsComputerEnabled();
-    emit lastMoveChanged();
-
-    return true;
-}
-
-
-QVariantList ChessEngine::getSavedGames() const
-{
-    QVariantList result;
-
-    for (int i = 0; i < savedGames.size(); i++) {
-        QVariantMap game;
-        game["slot"] = i;
-        game["name"] = savedGames[i].name;
-        game["date"] = savedGames[i].date;
-        game["gameMode"] = savedGames[i].gameMode;
-        game["difficulty"] = savedGames[i].difficulty;
-        game["status"] = savedGames[i].status;
-        result.append(game);
-    }
-
-    return result;
-}
-
-// Удаление сохраненной партии
-bool ChessEngine::deleteGame(int slot)
-{
-    if (slot < 0 || slot >= savedGames.size()) {
-        return false;
-    }
-
-    savedGames.remove(slot);
-    saveSavedGames();
-    emit savedGamesChanged();
-
-    return true;
-}
-
-
-void ChessEngine::loadSavedGames()
-{
-    savedGames.clear();
-
-    QSettings settings;
-    int count = settings.beginReadArray("savedGames");
-
-    for (int i = 0; i < count; i++) {
-        settings.setArrayIndex(i);
-
-        SavedGame game;
-        game.name = settings.value("name").toString();
-        game.date = settings.value("date").toString();
-        game.gameMode = settings.value("gameMode").toString();
-        game.difficulty = settings.value("difficulty").toInt();
-        game.status = settings.value("status").toString();
-        game.fen = settings.value("fen").toString();
-
-        QJsonDocument doc = QJsonDocument::fromJson(settings.value("moveHistory").toString().toUtf8());
-        QJsonArray historyArray = doc.array();
-
-        for (int j = 0; j < historyArray.size(); j += 2) {
-            QJsonObject fromObj = historyArray[j].toObject();
-            QJsonObject toObj = historyArray[j+1].toObject();
-
-            QPoint from(fromObj["x"].toInt(), fromObj["y"].toInt());
-            QPoint to(toObj["x"].toInt(), toObj["y"].toInt());
-
-            game.moveFromHistory.append(from);
-            game.moveToHistory.append(to);
-        }
-
-        savedGames.append(game);
-    }
-
-    settings.endArray();
-}
-
-
-void ChessEngine::saveSavedGames()
-{
-    QSettings settings;
-    settings.beginWriteArray("savedGames");
-
-    for (int i = 0; i < savedGames.size(); i++) {
-        settings.setArrayIndex(i);
-
-        settings.setValue("name", savedGames[i].name);
-        settings.setValue("date", savedGames[i].date);
-        settings.setValue("gameMode", savedGames[i].gameMode);
-        settings.setValue("difficulty", savedGames[i].difficulty);
-        settings.setValue("status", savedGames[i].status);
-        settings.setValue("fen", savedGames[i].fen);
-
-
-        QJsonArray historyArray;
-        for (int j = 0; j < savedGames[i].moveFromHistory.size(); j++) {
-            QJsonObject fromObj;
-            fromObj["x"] = savedGames[i].moveFromHistory[j].x();
-            fromObj["y"] = savedGames[i].moveFromHistory[j].y();
-
-            QJsonObject toObj;
-            toObj["x"] = savedGames[i].moveToHistory[j].x();
-            toObj["y"] = savedGames[i].moveToHistory[j].y();
-
-            historyArray.append(fromObj);
-            historyArray.append(toObj);
-        }
-
-        QJsonDocument doc(historyArray);
-        settings.setValue("moveHistory", QString(doc.toJson()));
-    }
-
-    settings.endArray();
-}
-
-
-QString ChessEngine::serializePosition(const Position& pos) const
-{
-
-
-
-    std::ostringstream fenStream;
-    fenStream << pos.getPieces();
-    QString fenPart = QString::fromStdString(fenStream.str().c_str());
-
-
-    fenPart = fenPart.trimmed();
-
-    QString extendedFen = fenPart;
-    extendedFen += "|" + QString::number(pos.getEnPassant());
-    extendedFen += "|" + QString::number(pos.getWLCastling() ? 1 : 0);
-    extendedFen += "|" + QString::number(pos.getWSCastling() ? 1 : 0);
-    extendedFen += "|" + QString::number(pos.getBLCastling() ? 1 : 0);
-    extendedFen += "|" + QString::number(pos.getBSCastling() ? 1 : 0);
-    extendedFen += "|" + QString::number(pos.whiteToMove() ? 1 : 0);
-
-    qDebug() << "Serialized FEN:" << extendedFen;
-
-    return extendedFen;
-}
-
-Position ChessEngine::deserializePosition(const QString& data)
-{
-    qDebug() << "Deserializing position from:" << data;
-
-    QStringList parts = data.split("|");
-    if (parts.size() < 7) {
-        qWarning() << "Invalid saved position data, expected 7+ parts, got" << parts.size();
-
-        return Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
-                        Position::NONE, true, true, true, true, 1);
-    }
-
-
-    std::string fenPart = parts[0].trimmed().toStdString();
-    qDebug() << "FEN part:" << QString::fromStdString(fenPart);
-
-    try {
-
-        int slashCount = 0;
-        for(char c : fenPart) {
-            if(c == '/') slashCount++;
-        }
-
-        if(slashCount != 7) {
-            qWarning() << "Invalid FEN format: wrong number of rows (slashes)";
-            return Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
-                            Position::NONE, true, true, true, true, 1);
-        }
-
-        uint8_t enPassant = parts[1].toUInt();
-        bool wlCastling = parts[2].toInt() != 0;
-        bool wsCastling = parts[3].toInt() != 0;
-        bool blCastling = parts[4].toInt() != 0;
-        bool bsCastling = parts[5].toInt() != 0;
-        float moveCtr = parts[6].toInt() != 0 ? 1.0f : 1.5f;
-
-
-        Position position(fenPart, enPassant, wlCastling, wsCastling, blCastling, bsCastling, moveCtr);
-
-
-        if (BOp::count1(position.getPieces().getAllBitboard()) == 0) {
-            qWarning() << "Position contains no pieces!";
-            return Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
-                            Position::NONE, true, true, true, true, 1);
-        }
-
-        return position;
-    }
-    catch (const std::exception& e) {
-        qWarning() << "Exception during position deserialization:" << e.what();
-        return Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
-                        Position::NONE, true, true, true, true, 1);
-    }
-}
-
-
-QString ChessEngine::getMoveHistoryJson() const
-{
-    QJsonArray historyArray;
-    for (const MoveHistoryItem& item : moveHistory) {
-        QJsonObject fromObj;
-        fromObj["x"] = item.moveFrom.x();
-        fromObj["y"] = item.moveFrom.y();
-
-        QJsonObject toObj;
-        toObj["x"] = item.moveTo.x();
-        toObj["y"] = item.moveTo.y();
-
-        historyArray.append(fromObj);
-        historyArray.append(toObj);
-    }
-
-    QJsonDocument doc(historyArray);
-    return QString(doc.toJson());
-}
-
-
-void ChessEngine::setMoveHistoryFromJson(const QString& historyJson)
-{
-    moveHistory.clear();
-
-    QJsonDocument doc = QJsonDocument::fromJson(historyJson.toUtf8());
-    QJsonArray historyArray = doc.array();
-
-    for (int i = 0; i < historyArray.size(); i += 2) {
-        QJsonObject fromObj = historyArray[i].toObject();
-        QJsonObject toObj = historyArray[i+1].toObject();
-
-        MoveHistoryItem item;
-        item.moveFrom = QPoint(fromObj["x"].toInt(), fromObj["y"].toInt());
-        item.moveTo = QPoint(toObj["x"].toInt(), toObj["y"].toInt());
-
-        moveHistory.push(item);
-    }
-
-    if (!moveHistory.isEmpty()) {
-        MoveHistoryItem lastItem = moveHistory.top();
-        lastMoveFrom = lastItem.moveFrom;
-        lastMoveTo = lastItem.moveTo;
-        hasLastMoveInfo = true;
-    } else {
-        hasLastMoveInfo = false;
-    }
-
-    emit canUndoChanged();
-    emit vsComputerEnabled();
-    emit lastMoveChanged();
-}
+#include "ChessEngine.h"
+#include <QCoreApplication>
+#include <QDebug>
+#include <QTimer>
+
+ChessEngine::ChessEngine(QObject *parent)
+    : QObject(parent),
+    selectedPiece(QPoint(-1, -1)),
+    currentStatus(STATUS::WHITE_TO_MOVE),
+    gameMode(GameMode::TwoPlayers),
+    m_difficulty(2), // По умолчанию средняя сложность
+    m_mateIn(0),
+    m_multiPV(1),
+    hasLastMoveInfo(false),
+    m_analysisMode(false),
+    m_analysisDepth(0),
+    m_analysisEvaluation(0),
+    m_analysisMate(0),
+    analysisGeneration(0)
+{
+    // Загружаем веса нейросетевой оценки, если файл лежит рядом с программой
+    QString networkPath = QCoreApplication::applicationDirPath() + "/nnue.bin";
+    if (NNUE::getPtr()->load(networkPath.toStdString())) {
+        NNUE::getPtr()->setEnabled(QSettings().value("evaluator").toString() == "nnue");
+    }
+
+    // Дебютная книга в формате Polyglot рядом с программой
+    QString dataDir = QCoreApplication::applicationDirPath();
+    PolyglotBook::getPtr()->load((dataDir + "/book.bin").toStdString());
+
+    // Эндшпильные таблицы Syzygy из каталога syzygy рядом с программой.
+    // Глубина, с которой таблицы опрашиваются в поиске, и предельное число фигур берутся из настроек
+    QSettings settings;
+    Syzygy::getPtr()->setProbeDepth(settings.value("syzygyProbeDepth", 1).toInt());
+    Syzygy::getPtr()->setPieceLimit(settings.value("syzygyPieceLimit", Syzygy::MAX_PIECES).toInt());
+    Syzygy::getPtr()->setPath((dataDir + "/syzygy").toStdString());
+
+    // Битовые базы простых окончаний (KPK, KBPK и т.п.) хранятся в каталоге данных приложения:
+    // каталог с программой после установки обычно доступен только для чтения.
+    // Если файла еще нет, строим их ретроградным анализом в фоне при первом запуске
+    QString appDataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(appDataDir);
+    std::string bitbasesPath = (appDataDir + "/bitbases.bin").toStdString();
+    if (!Bitbases::getPtr()->load(bitbasesPath)) {
+        bitbasesGeneration = std::async(std::launch::async, [bitbasesPath]() {
+            Bitbases::getPtr()->generate(std::thread::hardware_concurrency());
+            if (Bitbases::getPtr()->ready() && !Bitbases::getPtr()->save(bitbasesPath)) {
+                qWarning() << "Bitbases cannot be saved to" << QString::fromStdString(bitbasesPath);
+            }
+        });
+    }
+
+    // База сохраненных партий. Партии, сохраненные раньше в настройках, переносятся в нее при первом запуске
+    if (gameStore.open((appDataDir + "/games.bin").toStdString())) {
+        migrateSavedGames();
+    } else {
+        qWarning() << "Saved games database cannot be opened in" << appDataDir;
+    }
+
+    // Стартуем новую партию
+    startNewGame();
+}
+
+ChessEngine::~ChessEngine()
+{
+    stopAnalysis();
+    stopPondering();
+    if (bitbasesGeneration.valid()) {
+        Bitbases::getPtr()->stop();
+        bitbasesGeneration.wait();
+    }
+}
+
+void ChessEngine::startNewGame()
+{
+    stopPondering();
+
+    // Инициализация позиции на шахматной доске
+    position = Position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR",
+                        Position::NONE, true, true, true, true, SIDE::WHITE, 0, 1);
+    gameStartFen = QString::fromStdString(std::string(Notation::START_FEN));
+    repetitionHistory.clear();
+    repetitionHistory.push(position.getHash());
+    selectedPiece = QPoint(-1, -1);
+    currentStatus = STATUS::WHITE_TO_MOVE;
+
+    // Очищаем историю ходов и последний ход
+    moveHistory.clear();
+    redoHistory.clear();
+    hasLastMoveInfo = false;
+    m_mateIn = 0;
+    m_candidateLines.clear();
+
+    emit piecesChanged();
+    emit statusChanged();
+    emit canUndoChanged();
+    emit canRedoChanged();
+    emit vsComputerEnabled();
+    emit lastMoveChanged();
+    emit mateInChanged();
+    emit candidateLinesChanged();
+
+    restartAnalysis();
+}
+
+void ChessEngine::setGameMode(const QString& mode)
+{
+    stopPondering();
+
+    if (mode == "twoPlayers") {
+        gameMode = GameMode::TwoPlayers;
+    } else if (mode == "vsComputer") {
+        gameMode = GameMode::VsComputer;
+    }
+}
+
+QVariantList ChessEngine::getPieces() const
+{
+    QVariantList piecesList;
+
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            QString pieceName = getTextureName(x, y);
+            if (pieceName.isEmpty())
+                continue;
+
+            QVariantMap piece;
+            piece["x"] = x;
+            piece["y"] = y;
+            piece["type"] = pieceName;
+            piecesList.append(piece);
+        }
+    }
+
+    return piecesList;
+}
+
+QString ChessEngine::getTextureName(int x, int y) const
+{
+    // Имена текстур в порядке PIECE для каждой стороны
+    static const char* const TEXTURES[2][6] = {
+        { "whitePawn", "whiteKnight", "whiteBishop", "whiteRook", "whiteQueen", "whiteKing" },
+        { "blackPawn", "blackKnight", "blackBishop", "blackRook", "blackQueen", "blackKing" }
+    };
+
+    int index = y * 8 + x;
+    const Pieces& pieces = position.getPieces();
+
+    uint8_t type = pieces.getPieceType(index);
+    if (type == Pieces::NONE)
+        return "";
+
+    return TEXTURES[pieces.getPieceSide(index)][type];
+}
+
+QVariantList ChessEngine::getLegalMovesForPiece(int x, int y) const
+{
+    QVariantList moves;
+    int from = y * 8 + x;
+
+    // Получаем ходы только для фигур текущего игрока
+    const Pieces& pieces = position.getPieces();
+    if ((currentStatus == STATUS::WHITE_TO_MOVE &&
+         !BOp::getBit(pieces.getSideBitboard(SIDE::WHITE), from)) ||
+        (currentStatus == STATUS::BLACK_TO_MOVE &&
+         !BOp::getBit(pieces.getSideBitboard(SIDE::BLACK), from))) {
+        return moves;
+    }
+
+    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
+    MoveList legalMoves = LegalMoveGen::generate(position, side);
+
+    for (uint8_t i = 0; i < legalMoves.getSize(); i++) {
+        Move move = legalMoves[i];
+        if (move.getFrom() == from) {
+            int toX = move.getTo() % 8;
+            int toY = move.getTo() / 8;
+            QVariantMap moveMap;
+            moveMap["x"] = toX;
+            moveMap["y"] = toY;
+            moves.append(moveMap);
+        }
+    }
+
+    return moves;
+}
+
+void ChessEngine::recordMove(Move move)
+{
+    // Сохраняем сам ход и то, что нельзя восстановить по нему при отмене (рокировки, взятие на проходе, счетчики)
+    moveHistory.push({move, position.getUndo()});
+
+    // Новый ход обрывает цепочку отмененных ходов
+    if (!redoHistory.isEmpty()) {
+        redoHistory.clear();
+        emit canRedoChanged();
+    }
+
+    // Обновляем информацию о последнем ходе
+    setLastMove(move.getFrom() % 8, move.getFrom() / 8, move.getTo() % 8, move.getTo() / 8);
+
+    emit canUndoChanged();
+    emit vsComputerEnabled();
+}
+
+void ChessEngine::setLastMove(int fromX, int fromY, int toX, int toY)
+{
+    lastMoveFrom = QPoint(fromX, fromY);
+    lastMoveTo = QPoint(toX, toY);
+    hasLastMoveInfo = true;
+
+    qDebug() << "Last move set: " << fromX << "," << fromY << " to " << toX << "," << toY;
+
+    emit lastMoveChanged();
+}
+
+bool ChessEngine::processMove(int fromX, int fromY, int toX, int toY)
+{
+    if (currentStatus != STATUS::WHITE_TO_MOVE &&
+        currentStatus != STATUS::BLACK_TO_MOVE) {
+        return false;
+    }
+
+    // В режиме игры с компьютером, игрок может ходить только белыми
+    if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
+        return false;
+    }
+
+    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
+    uint8_t from = fromY * 8 + fromX;
+    uint8_t to = toY * 8 + toX;
+
+    MoveList moves = LegalMoveGen::generate(position, side);
+    int moveIndex = -1;
+    bool isPawnPromotion = false;
+
+
+    bool isWhitePawnPromotion = (side == SIDE::WHITE && toY == 7 &&
+                                 BOp::getBit(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::PAWN), from));
+    bool isBlackPawnPromotion = (side == SIDE::BLACK && toY == 0 &&
+                                 BOp::getBit(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::PAWN), from));
+
+    if (isWhitePawnPromotion || isBlackPawnPromotion) {
+        // Просто проверяем, что такой ход возможен (без учета типа превращения)
+        for (uint8_t i = 0; i < moves.getSize(); i++) {
+            Move move = moves[i];
+            if (move.getFrom() == from && move.getTo() == to &&
+                (move.getFlag() == Move::FLAG::PROMOTE_TO_QUEEN ||
+                 move.getFlag() == Move::FLAG::PROMOTE_TO_ROOK ||
+                 move.getFlag() == Move::FLAG::PROMOTE_TO_BISHOP ||
+                 move.getFlag() == Move::FLAG::PROMOTE_TO_KNIGHT)) {
+                isPawnPromotion = true;
+                // Ход записывается в историю после выбора фигуры, пока только подсвечиваем его
+                setLastMove(fromX, fromY, toX, toY);
+                // Мы нашли допустимый ход превращения пешки, но не выполняем его сейчас
+                // Вместо этого запрашиваем у пользователя тип фигуры
+                emit pawnPromotion(fromX, fromY, toX, toY);
+                return true; // Возвращаем true, чтобы показать, что ход будет обработан позже
+            }
+        }
+    }
+
+    // Если это не превращение пешки, продолжаем как обычно
+    if (!isPawnPromotion) {
+        for (uint8_t i = 0; i < moves.getSize(); i++) {
+            Move move = moves[i];
+            if (move.getFrom() == from && move.getTo() == to) {
+                moveIndex = i;
+                break;
+            }
+        }
+    }
+
+    if (moveIndex != -1) {
+        Move selectedMove = moves[moveIndex];
+
+        // Записываем ход в историю перед его выполнением
+        recordMove(selectedMove);
+
+        position.move(selectedMove);
+        repetitionHistory.push(position.getHash());
+        updateStatus();
+        emit piecesChanged();
+        emit statusChanged();
+        restartAnalysis();
+
+        if (currentStatus == STATUS::WHITE_WON ||
+            currentStatus == STATUS::BLACK_WON ||
+            currentStatus == STATUS::DRAW) {
+            QString result;
+            if (currentStatus == STATUS::WHITE_WON) {
+                result = "Белые победили!";
+            } else if (currentStatus == STATUS::BLACK_WON) {
+                result = "Чёрные победили!";
+            } else {
+                result = "Ничья!";
+            }
+            emit gameEnded(result);
+        }
+        // Если режим игры с компьютером и сейчас ход черных, компьютер делает ход
+        else if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
+            QTimer::singleShot(500, this, &ChessEngine::makeAIMove);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+bool ChessEngine::promotePawn(int fromX, int fromY, int toX, int toY, const QString& pieceType)
+{
+    uint8_t side = (currentStatus == STATUS::WHITE_TO_MOVE) ? SIDE::WHITE : SIDE::BLACK;
+    uint8_t from = fromY * 8 + fromX;
+    uint8_t to = toY * 8 + toX;
+
+    MoveList moves = LegalMoveGen::generate(position, side);
+    int moveIndex = -1;
+
+    // Определяем флаг превращения в зависимости от выбранного типа фигуры
+    Move::FLAG promotionFlag;
+    if (pieceType == "queen") {
+        promotionFlag = Move::FLAG::PROMOTE_TO_QUEEN;
+    } else if (pieceType == "rook") {
+        promotionFlag = Move::FLAG::PROMOTE_TO_ROOK;
+    } else if (pieceType == "bishop") {
+        promotionFlag = Move::FLAG::PROMOTE_TO_BISHOP;
+    } else if (pieceType == "knight") {
+        promotionFlag = Move::FLAG::PROMOTE_TO_KNIGHT;
+    } else {
+        // По умолчанию превращаем в ферзя
+        promotionFlag = Move::FLAG::PROMOTE_TO_QUEEN;
+    }
+
+    // Находим ход с соответствующим флагом
+    for (uint8_t i = 0; i < moves.getSize(); i++) {
+        Move move = moves[i];
+        if (move.getFrom() == from && move.getTo() == to && move.getFlag() == promotionFlag) {
+            moveIndex = i;
+            break;
+        }
+    }
+
+    if (moveIndex != -1) {
+        Move selectedMove = moves[moveIndex];
+
+        recordMove(selectedMove);
+
+        position.move(selectedMove);
+        repetitionHistory.push(position.getHash());
+        updateStatus();
+        emit piecesChanged();
+        emit statusChanged();
+        restartAnalysis();
+
+        if (currentStatus == STATUS::WHITE_WON ||
+            currentStatus == STATUS::BLACK_WON ||
+            currentStatus == STATUS::DRAW) {
+            QString result;
+            if (currentStatus == STATUS::WHITE_WON) {
+                result = "Белые победили!";
+            } else if (currentStatus == STATUS::BLACK_WON) {
+                result = "Чёрные победили!";
+            } else {
+                result = "Ничья!";
+            }
+            emit gameEnded(result);
+        }
+        // Если режим игры с компьютером и сейчас ход черных, компьютер делает ход
+        else if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
+            QTimer::singleShot(500, this, &ChessEngine::makeAIMove);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void ChessEngine::updateStatus()
+{
+    currentStatus = static_cast<STATUS>(getStatus());
+}
+
+QString ChessEngine::status() const
+{
+    return statusToString(currentStatus);
+}
+
+QString ChessEngine::statusToString(STATUS status)
+{
+    switch (status) {
+    case STATUS::WHITE_TO_MOVE: return "Ход белых";
+    case STATUS::BLACK_TO_MOVE: return "Ход чёрных";
+    case STATUS::WHITE_WON: return "Белые выиграли";
+    case STATUS::BLACK_WON: return "Чёрные выиграли";
+    case STATUS::DRAW: return "Ничья";
+    }
+    return "Неизвестно";
+}
+
+std::string ChessEngine::statusToResult(STATUS status)
+{
+    switch (status) {
+    case STATUS::WHITE_WON: return "1-0";
+    case STATUS::BLACK_WON: return "0-1";
+    case STATUS::DRAW: return "1/2-1/2";
+    default: return "*";
+    }
+}
+
+ChessEngine::STATUS ChessEngine::resultToStatus(const std::string& result, bool whiteToMove)
+{
+    if (result == "1-0") {
+        return STATUS::WHITE_WON;
+    }
+    if (result == "0-1") {
+        return STATUS::BLACK_WON;
+    }
+    if (result == "1/2-1/2") {
+        return STATUS::DRAW;
+    }
+    return whiteToMove ? STATUS::WHITE_TO_MOVE : STATUS::BLACK_TO_MOVE;
+}
+
+uint8_t ChessEngine::getStatus() const
+{
+    if (position.fiftyMovesRuleDraw() || repetitionHistory.getRepetitionNumber(position.getHalfmoveClock()) >= 3) {
+        return STATUS::DRAW;
+    }
+
+    if (!position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::PAWN) &&
+        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::PAWN) &&
+        !position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::ROOK) &&
+        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::ROOK) &&
+        !position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::QUEEN) &&
+        !position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::QUEEN) &&
+        BOp::count1(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::KNIGHT) |
+                    position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::BISHOP)) < 2 &&
+        BOp::count1(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::KNIGHT) |
+                    position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::BISHOP)) < 2) {
+        return STATUS::DRAW;
+    }
+
+    if (position.whiteToMove()) {
+        MoveList whiteMoves = LegalMoveGen::generate(position, SIDE::WHITE);
+        if (whiteMoves.getSize() == 0) {
+            bool whiteInCheck = PsLegalMoveMaskGen::inDanger(
+                position.getPieces(),
+                BOp::bsf(position.getPieces().getPieceBitboard(SIDE::WHITE, PIECE::KING)),
+                SIDE::WHITE
+                );
+            return whiteInCheck ? STATUS::BLACK_WON : STATUS::DRAW;
+        }
+        return STATUS::WHITE_TO_MOVE;
+    } else {
+        MoveList blackMoves = LegalMoveGen::generate(position, SIDE::BLACK);
+        if (blackMoves.getSize() == 0) {
+            bool blackInCheck = PsLegalMoveMaskGen::inDanger(
+                position.getPieces(),
+                BOp::bsf(position.getPieces().getPieceBitboard(SIDE::BLACK, PIECE::KING)),
+                SIDE::BLACK
+                );
+            return blackInCheck ? STATUS::WHITE_WON : STATUS::DRAW;
+        }
+        return STATUS::BLACK_TO_MOVE;
+    }
+}
+
+bool ChessEngine::undoLastMove()
+{
+    if (moveHistory.isEmpty()) {
+        return false;
+    }
+
+    stopPondering();
+
+    MoveHistoryItem lastMove = moveHistory.pop();
+    position.undoMove(lastMove.move, lastMove.undo);
+    repetitionHistory.pop();
+    redoHistory.push(lastMove.move);
+
+    // Обновляем последний ход для визуализации
+    if (!moveHistory.isEmpty()) {
+        Move prevMove = moveHistory.top().move;
+        lastMoveFrom = QPoint(prevMove.getFrom() % 8, prevMove.getFrom() / 8);
+        lastMoveTo = QPoint(prevMove.getTo() % 8, prevMove.getTo() / 8);
+        hasLastMoveInfo = true;
+    } else {
+        hasLastMoveInfo = false;
+    }
+
+    updateStatus();
+    emit piecesChanged();
+    emit canUndoChanged();
+    emit canRedoChanged();
+    emit vsComputerEnabled();
+    emit lastMoveChanged();
+    emit statusChanged();
+
+    restartAnalysis();
+
+    return true;
+}
+
+bool ChessEngine::redoLastMove()
+{
+    if (redoHistory.isEmpty()) {
+        return false;
+    }
+
+    stopPondering();
+
+    Move move = redoHistory.pop();
+    moveHistory.push({move, position.getUndo()});
+    position.move(move);
+    repetitionHistory.push(position.getHash());
+    setLastMove(move.getFrom() % 8, move.getFrom() / 8, move.getTo() % 8, move.getTo() / 8);
+
+    updateStatus();
+    emit piecesChanged();
+    emit canUndoChanged();
+    emit canRedoChanged();
+    emit vsComputerEnabled();
+    emit statusChanged();
+
+    restartAnalysis();
+
+    // Возвращен только ход игрока: отвечает компьютер
+    if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE && redoHistory.isEmpty()) {
+        QTimer::singleShot(500, this, &ChessEngine::makeAIMove);
+    }
+
+    return true;
+}
+
+bool ChessEngine::canUndo() const
+{
+    return !moveHistory.isEmpty();
+}
+
+bool ChessEngine::canRedo() const
+{
+    return !redoHistory.isEmpty();
+}
+
+bool ChessEngine::vsComputer() const
+{
+    return gameMode == GameMode::VsComputer;
+}
+
+QPoint ChessEngine::getLastMoveFrom() const
+{
+    return lastMoveFrom;
+}
+
+QPoint ChessEngine::getLastMoveTo() const
+{
+    return lastMoveTo;
+}
+
+bool ChessEngine::hasLastMove() const
+{
+    return hasLastMoveInfo;
+}
+
+int ChessEngine::difficulty() const
+{
+    return m_difficulty;
+}
+
+void ChessEngine::setDifficulty(int newDifficulty)
+{
+    if (newDifficulty < 1)
+        newDifficulty = 1;
+    else if (newDifficulty > 3)
+        newDifficulty = 3;
+
+    if (m_difficulty != newDifficulty) {
+        m_difficulty = newDifficulty;
+        emit difficultyChanged();
+    }
+}
+
+QString ChessEngine::getDifficultyName() const
+{
+    switch (m_difficulty) {
+    case 1: return "Легкий";
+    case 2: return "Средний";
+    case 3: return "Сложный";
+    default: return "Средний";
+    }
+}
+
+QString ChessEngine::evaluator() const
+{
+    return NNUE::getPtr()->enabled() ? "nnue" : "classical";
+}
+
+void ChessEngine::setEvaluator(const QString& name)
+{
+    bool useNetwork = (name == "nnue" && NNUE::getPtr()->loaded());
+    if (useNetwork == NNUE::getPtr()->enabled()) {
+        return;
+    }
+
+    // Поиск в фоне читает флаг оценки и аккумуляторы сети, поэтому на время
+    // переключения его останавливаем, а анализ затем запускаем заново
+    stopAnalysis();
+    stopPondering();
+
+    NNUE::getPtr()->setEnabled(useNetwork);
+    QSettings().setValue("evaluator", evaluator());
+    emit evaluatorChanged();
+
+    restartAnalysis();
+}
+
+bool ChessEngine::nnueAvailable() const
+{
+    return NNUE::getPtr()->loaded();
+}
+
+int ChessEngine::mateIn() const
+{
+    return m_mateIn;
+}
+
+int ChessEngine::multiPV() const
+{
+    return m_multiPV;
+}
+
+void ChessEngine::setMultiPV(int newMultiPV)
+{
+    newMultiPV = qBound(1, newMultiPV, 5);
+    if (m_multiPV != newMultiPV) {
+        m_multiPV = newMultiPV;
+        emit multiPVChanged();
+    }
+}
+
+QVariantList ChessEngine::candidateLines() const
+{
+    return m_candidateLines;
+}
+
+bool ChessEngine::analysisMode() const
+{
+    return m_analysisMode;
+}
+
+void ChessEngine::setAnalysisMode(bool enabled)
+{
+    if (m_analysisMode == enabled) {
+        return;
+    }
+
+    m_analysisMode = enabled;
+    m_analysisDepth = 0;
+    m_analysisEvaluation = 0;
+    m_analysisMate = 0;
+    emit analysisModeChanged();
+    emit analysisChanged();
+
+    restartAnalysis();
+}
+
+int ChessEngine::analysisDepth() const
+{
+    return m_analysisDepth;
+}
+
+int ChessEngine::analysisEvaluation() const
+{
+    return m_analysisEvaluation;
+}
+
+int ChessEngine::analysisMate() const
+{
+    return m_analysisMate;
+}
+
+void ChessEngine::setCandidateLines(int depth, const std::vector<AI::Line>& lines)
+{
+    QVariantList candidates;
+    for (const AI::Line& line : lines) {
+        QStringList pv;
+        for (uint8_t i = 0; i < line.pv.getSize(); i++) {
+            pv.append(moveToString(line.pv[i]));
+        }
+
+        QVariantMap candidate;
+        candidate["move"] = moveToString(line.move);
+        candidate["evaluation"] = line.evaluation;
+        candidate["mate"] = line.mate;
+        candidate["depth"] = depth;
+        candidate["pv"] = pv.join(" ");
+        candidates.append(candidate);
+    }
+
+    m_candidateLines = candidates;
+    emit candidateLinesChanged();
+}
+
+QString ChessEngine::moveToString(Move move)
+{
+    return QString::fromStdString(Notation::writeUci(move));
+}
+
+void ChessEngine::makeAIMove()
+{
+    if (currentStatus != STATUS::BLACK_TO_MOVE) {
+        stopPondering();
+        return;
+    }
+
+    // Компьютер думает сам, фоновый анализ на это время останавливаем
+    stopAnalysis();
+
+
+    AI::Result result;
+    Move bookMove = PolyglotBook::getPtr()->probe(position, SIDE::BLACK);
+    if (bookMove.getFrom() != Move::NONE) {
+        // Позиция есть в дебютной книге: ход берется сразу, без поиска
+        stopPondering();
+        result = {bookMove, 0, 0, {}};
+        setCandidateLines(0, result.lines);
+    } else if (ponderSearch.valid() && ponderPosition.getHash() == position.getHash()) {
+        // Соперник сделал предсказанный ход: фоновый поиск продолжается как обычный,
+        // время, потраченное на него во время хода соперника, уже засчитано
+        ponderTimeManager->setInfinite(false);
+        result = ponderSearch.get();
+        setCandidateLines(0, result.lines);
+    } else {
+        stopPondering();
+
+        // AI делает ход с учетом сложности
+        TimeManager timeManager(thinkingTime());
+        result = AI::getBestMove(position, SIDE::BLACK, timeManager, repetitionHistory, m_multiPV,
+                                 [this](int32_t depth, const std::vector<AI::Line>& lines) {
+                                     setCandidateLines(depth, lines);
+                                 });
+    }
+    Move aiMove = result.move;
+
+    if (m_mateIn != result.mate) {
+        m_mateIn = result.mate;
+        emit mateInChanged();
+    }
+
+    recordMove(aiMove);
+
+
+    position.move(aiMove);
+    repetitionHistory.push(position.getHash());
+    updateStatus();
+
+
+    emit piecesChanged();
+    emit statusChanged();
+
+    // Проверка на конец игры
+    if (currentStatus == STATUS::WHITE_WON ||
+        currentStatus == STATUS::BLACK_WON ||
+        currentStatus == STATUS::DRAW) {
+        QString result;
+        if (currentStatus == STATUS::WHITE_WON) {
+            result = "Белые победили!";
+        } else if (currentStatus == STATUS::BLACK_WON) {
+            result = "Чёрные победили!";
+        } else {
+            result = "Ничья!";
+        }
+        emit gameEnded(result);
+        return;
+    }
+
+    if (m_analysisMode) {
+        restartAnalysis();
+    } else {
+        startPondering();
+    }
+}
+
+int ChessEngine::thinkingTime() const
+{
+    switch (m_difficulty) {
+    case 1: // Легкий
+        return 500; // 0.5 секунд
+    case 2: // Средний
+        return 1000; // 1 секунда
+    case 3: // Сложный
+        return 2000; // 2 секунды
+    default:
+        return 1000;
+    }
+}
+
+void ChessEngine::startPondering()
+{
+    // Предполагаемый ответ соперника берем из главного варианта последнего поиска
+    MoveList pv = AI::getPrincipalVariation(position, SIDE::WHITE, 1);
+    if (pv.getSize() == 0) {
+        return;
+    }
+
+    ponderPosition = position;
+    ponderPosition.move(pv[0]);
+    RepetitionHistory ponderHistory = repetitionHistory;
+    ponderHistory.push(ponderPosition.getHash());
+
+    ponderTimeManager = std::make_unique<TimeManager>(thinkingTime());
+    ponderTimeManager->setInfinite(true);
+
+    TimeManager* timeManager = ponderTimeManager.get();
+    Position searchPosition = ponderPosition;
+    ponderSearch = std::async(std::launch::async, [timeManager, searchPosition, ponderHistory]() {
+        return AI::getBestMove(searchPosition, SIDE::BLACK, *timeManager, ponderHistory);
+    });
+}
+
+void ChessEngine::restartAnalysis()
+{
+    stopAnalysis();
+
+    if (!m_analysisMode) {
+        return;
+    }
+    if (currentStatus != STATUS::WHITE_TO_MOVE && currentStatus != STATUS::BLACK_TO_MOVE) {
+        return;
+    }
+    // Ход компьютера: анализ возобновится после его ответа
+    if (gameMode == GameMode::VsComputer && currentStatus == STATUS::BLACK_TO_MOVE) {
+        return;
+    }
+
+    stopPondering();
+
+    analysisTimeManager = std::make_unique<TimeManager>(0);
+    analysisTimeManager->setInfinite(true);
+
+    // Поиск идет в отдельном потоке, а результаты итераций передаются в поток интерфейса
+    // не чаще, чем раз в ANALYSIS_UPDATE_INTERVAL мс; устаревшие результаты отбрасываются по номеру запуска
+    int generation = analysisGeneration;
+    TimeManager* timeManager = analysisTimeManager.get();
+    Position searchPosition = position;
+    RepetitionHistory searchHistory = repetitionHistory;
+    uint8_t multiPV = m_multiPV;
+    analysisSearch = std::async(std::launch::async, [this, generation, timeManager, searchPosition, searchHistory, multiPV]() {
+        auto lastUpdate = std::chrono::steady_clock::now() - std::chrono::milliseconds(ANALYSIS_UPDATE_INTERVAL);
+        int lastDepth = 0;
+        bool lastSent = true;
+        AI::Result result = AI::getBestMove(searchPosition, searchPosition.getSide(), *timeManager, searchHistory, multiPV,
+                                            [this, generation, &lastUpdate, &lastDepth, &lastSent](int32_t depth, const std::vector<AI::Line>& lines) {
+            auto now = std::chrono::steady_clock::now();
+            lastDepth = depth;
+            lastSent = (now - lastUpdate >= std::chrono::milliseconds(ANALYSIS_UPDATE_INTERVAL));
+            if (!lastSent) {
+                return;
+            }
+            lastUpdate = now;
+            QMetaObject::invokeMethod(this, [this, generation, depth, lines]() {
+                setAnalysisResult(generation, depth, lines);
+            }, Qt::QueuedConnection);
+        });
+
+        // Если поиск завершился сам (например, найден мат), последняя итерация передается в любом случае
+        if (!lastSent) {
+            std::vector<AI::Line> lines = result.lines;
+            QMetaObject::invokeMethod(this, [this, generation, lastDepth, lines]() {
+                setAnalysisResult(generation, lastDepth, lines);
+            }, Qt::QueuedConnection);
+        }
+        return result;
+    });
+}
+
+void ChessEngine::stopAnalysis()
+{
+    analysisGeneration++;
+
+    if (!analysisSearch.valid()) {
+        return;
+    }
+
+    analysisTimeManager->setInfinite(false);
+    SearchInterrupter::getPtr()->interrupt();
+    analysisSearch.get();
+}
+
+void ChessEngine::setAnalysisResult(int generation, int depth, const std::vector<AI::Line>& lines)
+{
+    if (generation != analysisGeneration || lines.empty()) {
+        return;
+    }
+
+    const AI::Line& best = lines.front();
+    uint8_t side = position.getSide();
+    m_analysisDepth = depth;
+    m_analysisEvaluation = best.evaluation;
+    m_analysisMate = (side == SIDE::WHITE) ? best.mate : -best.mate;
+    emit analysisChanged();
+
+    setCandidateLines(depth, lines);
+}
+
+void ChessEngine::stopPondering()
+{
+    if (!ponderSearch.valid()) {
+        return;
+    }
+
+    // Останавливаем фоновый поиск, его результат больше не нужен
+    ponderTimeManager->setInfinite(false);
+    SearchInterrupter::getPtr()->interrupt();
+    ponderSearch.get();
+}
+
+
+bool ChessEngine::saveGame(const QString& name)
+{
+    GameStore::Header header;
+    header.name = name.toStdString();
+    header.date = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm").toStdString();
+    header.gameMode = (gameMode == GameMode::TwoPlayers) ? "twoPlayers" : "vsComputer";
+    header.difficulty = m_difficulty;
+    header.status = statusToString(currentStatus).toStdString();
+    header.startFen = gameStartFen.toStdString();
+
+
+    std::vector<Move> moves;
+    for (const MoveHistoryItem& item : moveHistory) {
+        moves.push_back(item.move);
+    }
+
+
+    // Партия дописывается в конец базы, остальные записи не переписываются
+    if (!gameStore.append(header, moves) || !gameStore.flush()) {
+        return false;
+    }
+    emit savedGamesChanged();
+
+    return true;
+}
+
+
+bool ChessEngine::loadGame(int slot)
+{
+    if (slot < 0 || slot >= (int)gameStore.getSize()) {
+        return false;
+    }
+
+    const GameStore::Header& header = gameStore.getHeader(slot);
+
+    // Ходы партии читаются из базы только при загрузке
+    Pgn::Game pgnGame;
+    if (!savedGameToPgn(slot, pgnGame)) {
+        qWarning() << "Saved game cannot be replayed:" << QString::fromStdString(header.name);
+        return false;
+    }
+
+    stopPondering();
+
+
+    if (header.gameMode == "twoPlayers") {
+        gameMode = GameMode::TwoPlayers;
+    } else {
+        gameMode = GameMode::VsComputer;
+    }
+
+
+    m_difficulty = header.difficulty;
+
+
+    restoreGame(pgnGame);
+
+
+    updateStatus();
+
+
+    emit piecesChanged();
+    emit statusChanged();
+    emit difficultyChanged();
+    emit canUndoChanged();
+    emit canRedoChanged();
+    emit vsComputerEnabled();
+    emit lastMoveChanged();
+
+    restartAnalysis();
+
+    return true;
+}
+
+
+QVariantList ChessEngine::getSavedGames() const
+{
+    QVariantList result;
+
+    for (uint32_t i = 0; i < gameStore.getSize(); i++) {
+        const GameStore::Header& header = gameStore.getHeader(i);
+        QVariantMap game;
+        game["slot"] = i;
+        game["name"] = QString::fromStdString(header.name);
+        game["date"] = QString::fromStdString(header.date);
+        game["gameMode"] = QString::fromStdString(header.gameMode);
+        game["difficulty"] = (int)header.difficulty;
+        game["status"] = QString::fromStdString(header.status);
+        result.append(game);
+    }
+
+    return result;
+}
+
+// Удаление сохраненной партии
+bool ChessEngine::deleteGame(int slot)
+{
+    if (slot < 0 || slot >= (int)gameStore.getSize()) {
+        return false;
+    }
+
+    if (!gameStore.remove(slot) || !gameStore.flush()) {
+        return false;
+    }
+    emit savedGamesChanged();
+
+    return true;
+}
+
+
+QVariantList ChessEngine::findSavedGames()
+{
+    QVariantList result;
+
+    for (GameStore::Occurrence occurrence : gameStore.find(position.getHash())) {
+        QVariantMap game;
+        game["slot"] = occurrence.slot;
+        game["name"] = QString::fromStdString(gameStore.getHeader(occurrence.slot).name);
+        game["ply"] = occurrence.ply;
+        result.append(game);
+    }
+
+    return result;
+}
+
+
+bool ChessEngine::exportPgn(const QString& path) const
+{
+    std::ofstream file(localFilePath(path).toStdString(), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    return Pgn::write(file, currentPgnGame());
+}
+
+
+bool ChessEngine::exportSavedGames(const QString& path)
+{
+    std::ofstream file(localFilePath(path).toStdString(), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    for (uint32_t slot = 0; slot < gameStore.getSize(); slot++) {
+        Pgn::Game pgnGame;
+        if (!savedGameToPgn(slot, pgnGame) || !Pgn::write(file, pgnGame)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+int ChessEngine::importPgn(const QString& path)
+{
+    Pgn pgn(localFilePath(path).toStdString());
+    if (!pgn.isOpen()) {
+        return -1;
+    }
+
+    // Партии читаются по одной, проверяются проигрыванием на доске и сразу дописываются в базу
+    int imported = 0;
+    Pgn::Game pgnGame;
+    while (pgn.read(pgnGame)) {
+        if (!pgnGame.legal) {
+            qWarning() << "Skipping PGN game with an illegal move at offset" << pgn.getGameOffset();
+            continue;
+        }
+
+        Position start;
+        Notation::parseFen(pgnGame.startFen, start);
+        bool whiteToMove = (start.whiteToMove() == (pgnGame.moves.size() % 2 == 0));
+
+        GameStore::Header header;
+        header.name = pgnGame.getTag("White") + " - " + pgnGame.getTag("Black");
+        header.date = pgnGame.getTag("Date");
+        header.gameMode = "twoPlayers";
+        header.difficulty = m_difficulty;
+        header.status = statusToString(resultToStatus(pgnGame.result, whiteToMove)).toStdString();
+        header.startFen = pgnGame.startFen;
+        if (!gameStore.append(header, pgnGame.moves)) {
+            break;
+        }
+
+        imported = imported + 1;
+    }
+
+    gameStore.flush();
+    if (imported > 0) {
+        emit savedGamesChanged();
+    }
+    return imported;
+}
+
+
+void ChessEngine::migrateSavedGames()
+{
+    QSettings settings;
+    int count = settings.beginReadArray("savedGames");
+
+    for (int i = 0; i < count; i++) {
+        settings.setArrayIndex(i);
+
+        GameStore::Header header;
+        header.name = settings.value("name").toString().toStdString();
+        header.date = settings.value("date").toString().toStdString();
+        header.gameMode = settings.value("gameMode").toString().toStdString();
+        header.difficulty = settings.value("difficulty").toInt();
+        header.status = settings.value("status").toString().toStdString();
+
+        // В старых сохранениях есть только итоговая позиция, партия начинается с нее
+        QString fen = settings.value("startFen", settings.value("fen")).toString();
+        Position replayed = deserializePosition(fen);
+        header.startFen = Notation::writeFen(replayed);
+
+        std::vector<Move> moves;
+        for (const QString& uci : settings.value("moves").toString().split(' ', Qt::SkipEmptyParts)) {
+            Move move = Notation::parseUci(replayed, uci.toStdString());
+            if (move.getFrom() == Move::NONE) {
+                break;
+            }
+            moves.push_back(move);
+            replayed.move(move);
+        }
+
+        gameStore.append(header, moves);
+    }
+
+    settings.endArray();
+
+    if (count > 0 && gameStore.flush()) {
+        settings.remove("savedGames");
+    }
+}
+
+
+Position ChessEngine::deserializePosition(const QString& data)
+{
+    Position position;
+    if (!Notation::parseFen(data.trimmed().toStdString(), position)) {
+        // Старые сохранения писали доску в нечитаемом виде, такие позиции заменяем начальной
+        qWarning() << "Invalid saved position FEN:" << data;
+        Notation::parseFen(Notation::START_FEN, position);
+    }
+    return position;
+}
+
+
+Pgn::Game ChessEngine::currentPgnGame() const
+{
+    bool computer = (gameMode == GameMode::VsComputer);
+
+    Pgn::Game game;
+    game.setTag("Event", "Chess-QML");
+    game.setTag("Date", QDate::currentDate().toString("yyyy.MM.dd").toStdString());
+    game.setTag("White", computer ? "Player" : "?");
+    game.setTag("Black", computer ? "Chess-QML" : "?");
+    game.startFen = gameStartFen.toStdString();
+    game.result = statusToResult(currentStatus);
+    game.legal = true;
+    for (const MoveHistoryItem& item : moveHistory) {
+        game.moves.push_back(item.move);
+    }
+    return game;
+}
+
+
+bool ChessEngine::savedGameToPgn(int slot, Pgn::Game& pgnGame)
+{
+    const GameStore::Header& header = gameStore.getHeader(slot);
+    QString status = QString::fromStdString(header.status);
+
+    pgnGame = Pgn::Game();
+    pgnGame.setTag("Event", header.name);
+    pgnGame.setTag("Date", QString::fromStdString(header.date).left(10).replace('-', '.').toStdString());
+    pgnGame.setTag("White", header.gameMode == "vsComputer" ? "Player" : "?");
+    pgnGame.setTag("Black", header.gameMode == "vsComputer" ? "Chess-QML" : "?");
+    pgnGame.startFen = header.startFen;
+    pgnGame.result = "*";
+    for (STATUS result : {STATUS::WHITE_WON, STATUS::BLACK_WON, STATUS::DRAW}) {
+        if (status == statusToString(result)) {
+            pgnGame.result = statusToResult(result);
+        }
+    }
+    pgnGame.legal = gameStore.load(slot, pgnGame.moves);
+    return pgnGame.legal;
+}
+
+
+void ChessEngine::restoreGame(const Pgn::Game& pgnGame)
+{
+    Notation::parseFen(pgnGame.startFen, position);
+    gameStartFen = QString::fromStdString(pgnGame.startFen);
+    repetitionHistory.clear();
+    repetitionHistory.push(position.getHash());
+
+    // История ходов восстанавливается проигрыванием партии, чтобы ходы можно было отменять
+    moveHistory.clear();
+    redoHistory.clear();
+    for (Move move : pgnGame.moves) {
+        moveHistory.push({move, position.getUndo()});
+        position.move(move);
+        repetitionHistory.push(position.getHash());
+    }
+
+    if (!moveHistory.isEmpty()) {
+        Move lastMove = moveHistory.top().move;
+        lastMoveFrom = QPoint(lastMove.getFrom() % 8, lastMove.getFrom() / 8);
+        lastMoveTo = QPoint(lastMove.getTo() % 8, lastMove.getTo() / 8);
+        hasLastMoveInfo = true;
+    } else {
+        hasLastMoveInfo = false;
+    }
+    m_mateIn = 0;
+    m_candidateLines.clear();
+}
+
+
+QString ChessEngine::localFilePath(const QString& path)
+{
+    // Диалоги выбора файла в QML передают пути в виде file:// URL
+    QUrl url(path);
+    return url.isLocalFile() ? url.toLocalFile() : path;
+}
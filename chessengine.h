@@ -1,133 +1,212 @@
-#pragma once
-
-#include <QObject>
-#include <QString>
-#include <QVariant>
-#include <QVector>
-#include <QMap>
-#include <QPoint>
-#include <QTimer>
-#include <QStack>
-#include <chrono>
-#include <QSettings>
-#include <QDateTime>
-#include <QJsonObject>
-#include <QJsonArray>
-#include <QJsonDocument>
-#include "Position.h"
-#include "AI.h"
-
-#define nsecs std::chrono::high_resolution_clock::now().time_since_epoch().count()
-
-class ChessEngine : public QObject
-{
-    Q_OBJECT
-    Q_PROPERTY(QString status READ status NOTIFY statusChanged)
-    Q_PROPERTY(int difficulty READ difficulty WRITE setDifficulty NOTIFY difficultyChanged)
-    Q_PROPERTY(bool canUndo READ canUndo NOTIFY canUndoChanged)
-    Q_PROPERTY(bool vsComputer READ vsComputer NOTIFY vsComputerEnabled)
-
-public:
-    explicit ChessEngine(QObject *parent = nullptr);
-
-    Q_INVOKABLE QVariantList getPieces() const;
-    Q_INVOKABLE bool processMove(int fromX, int fromY, int toX, int toY);
-    Q_INVOKABLE QVariantList getLegalMovesForPiece(int x, int y) const;
-    Q_INVOKABLE void startNewGame();
-    Q_INVOKABLE void setGameMode(const QString& mode);
-    Q_INVOKABLE QString getTextureName(int x, int y) const;
-    Q_INVOKABLE void makeAIMove();
-    Q_INVOKABLE bool promotePawn(int fromX, int fromY, int toX, int toY, const QString& pieceType);
-
-    // Методы для отмены хода
-    Q_INVOKABLE bool undoLastMove();
-    bool canUndo() const;
-    bool vsComputer() const;
-
-    // Методы для выделения хода компьютера
-    Q_INVOKABLE QPoint getLastMoveFrom() const;
-    Q_INVOKABLE QPoint getLastMoveTo() const;
-    Q_INVOKABLE bool hasLastMove() const;
-
-    // Методы для сохранения/загрузки партий
-    Q_INVOKABLE bool saveGame(const QString& name);
-    Q_INVOKABLE bool loadGame(int slot);
-    Q_INVOKABLE QVariantList getSavedGames() const;
-    Q_INVOKABLE bool deleteGame(int slot);
-
-    // Методы для работы со сложностью
-    int difficulty() const;
-    void setDifficulty(int newDifficulty);
-    Q_INVOKABLE QString getDifficultyName() const;
-
-    QString status() const;
-
-signals:
-    void piecesChanged();
-    void statusChanged();
-    void gameEnded(const QString& result);
-    void pawnPromotion(int fromX, int fromY, int toX, int toY);
-    void difficultyChanged();
-    void canUndoChanged();
-    void lastMoveChanged();
-    void savedGamesChanged();
-    void vsComputerEnabled();
-
-private:
-    enum STATUS {
-        WHITE_TO_MOVE,
-        BLACK_TO_MOVE,
-        WHITE_WON,
-        BLACK_WON,
-        DRAW
-    };
-
-    enum class GameMode {
-        TwoPlayers,
-        VsComputer
-    };
-
-    struct MoveHistoryItem {
-        Position position;
-        QPoint moveFrom;
-        QPoint moveTo;
-    };
-
-    struct SavedGame {
-        QString name;
-        QString date;
-        QString gameMode;
-        int difficulty;
-        QString status;
-        QString fen;
-        QVector<QPoint> moveFromHistory;
-        QVector<QPoint> moveToHistory;
-    };
-
-    Position position;
-    QPoint selectedPiece;
-    STATUS currentStatus;
-    GameMode gameMode;
-    int m_difficulty; // 1 - легкий, 2 - средний, 3 - сложный
-
-    QStack<MoveHistoryItem> moveHistory;
-    QPoint lastMoveFrom;
-    QPoint lastMoveTo;
-    bool hasLastMoveInfo;
-
-    QVector<SavedGame> savedGames;
-
-    void updateStatus();
-    QString statusToString() const;
-    uint8_t getStatus() const;
-    void recordMove(int fromX, int fromY, int toX, int toY);
-    void setLastMove(int fromX, int fromY, int toX, int toY);
-
-    // Вспомогательные методы для сохранения/загрузки
-    void loadSavedGames();
-    void saveSavedGames();
-    QString serializePosition(const Position& pos) const;
-    Position deserializePosition(const QString& data);
-    QString getMoveHistoryJson() const;
-    void setMoveHistoryFromJson(const QString& historyJson);
-};
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <QMap>
+#include <QPoint>
+#include <QTimer>
+#include <QStack>
+#include <QStringList>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <QSettings>
+#include <QDateTime>
+#include <QUrl>
+#include <QDir>
+#include <QStandardPaths>
+#include "Position.h"
+#include "AI.h"
+#include "PolyglotBook.h"
+#include "Notation.h"
+#include "Pgn.h"
+#include "GameStore.h"
+
+#define nsecs std::chrono::high_resolution_clock::now().time_since_epoch().count()
+
+class ChessEngine : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QString status READ status NOTIFY statusChanged)
+    Q_PROPERTY(int difficulty READ difficulty WRITE setDifficulty NOTIFY difficultyChanged)
+    Q_PROPERTY(bool canUndo READ canUndo NOTIFY canUndoChanged)
+    Q_PROPERTY(bool canRedo READ canRedo NOTIFY canRedoChanged)
+    Q_PROPERTY(bool vsComputer READ vsComputer NOTIFY vsComputerEnabled)
+    Q_PROPERTY(QString evaluator READ evaluator WRITE setEvaluator NOTIFY evaluatorChanged)
+    Q_PROPERTY(int mateIn READ mateIn NOTIFY mateInChanged)
+    Q_PROPERTY(int multiPV READ multiPV WRITE setMultiPV NOTIFY multiPVChanged)
+    Q_PROPERTY(QVariantList candidateLines READ candidateLines NOTIFY candidateLinesChanged)
+    Q_PROPERTY(bool analysisMode READ analysisMode WRITE setAnalysisMode NOTIFY analysisModeChanged)
+    Q_PROPERTY(int analysisDepth READ analysisDepth NOTIFY analysisChanged)
+    Q_PROPERTY(int analysisEvaluation READ analysisEvaluation NOTIFY analysisChanged)
+    Q_PROPERTY(int analysisMate READ analysisMate NOTIFY analysisChanged)
+
+public:
+    explicit ChessEngine(QObject *parent = nullptr);
+    ~ChessEngine() override;
+
+    Q_INVOKABLE QVariantList getPieces() const;
+    Q_INVOKABLE bool processMove(int fromX, int fromY, int toX, int toY);
+    Q_INVOKABLE QVariantList getLegalMovesForPiece(int x, int y) const;
+    Q_INVOKABLE void startNewGame();
+    Q_INVOKABLE void setGameMode(const QString& mode);
+    Q_INVOKABLE QString getTextureName(int x, int y) const;
+    Q_INVOKABLE void makeAIMove();
+    Q_INVOKABLE bool promotePawn(int fromX, int fromY, int toX, int toY, const QString& pieceType);
+
+    // Методы для отмены хода и возврата отмененного
+    Q_INVOKABLE bool undoLastMove();
+    Q_INVOKABLE bool redoLastMove();
+    bool canUndo() const;
+    bool canRedo() const;
+    bool vsComputer() const;
+
+    // Методы для выделения хода компьютера
+    Q_INVOKABLE QPoint getLastMoveFrom() const;
+    Q_INVOKABLE QPoint getLastMoveTo() const;
+    Q_INVOKABLE bool hasLastMove() const;
+
+    // Методы для сохранения/загрузки партий
+    Q_INVOKABLE bool saveGame(const QString& name);
+    Q_INVOKABLE bool loadGame(int slot);
+    Q_INVOKABLE QVariantList getSavedGames() const;
+    Q_INVOKABLE bool deleteGame(int slot);
+
+    // Сохраненные партии, в которых встречалась текущая позиция: слот, название и номер полухода
+    Q_INVOKABLE QVariantList findSavedGames();
+
+    // Экспорт текущей или всех сохраненных партий в PGN и импорт партий из PGN-файла.
+    // Импорт читает файл по одной партии и дописывает партии в базу сохранений.
+    // Возвращает число импортированных партий или -1
+    Q_INVOKABLE bool exportPgn(const QString& path) const;
+    Q_INVOKABLE bool exportSavedGames(const QString& path);
+    Q_INVOKABLE int importPgn(const QString& path);
+
+    // Методы для работы со сложностью
+    int difficulty() const;
+    void setDifficulty(int newDifficulty);
+    Q_INVOKABLE QString getDifficultyName() const;
+
+    // Выбор функции оценки: "classical" или "nnue"
+    QString evaluator() const;
+    void setEvaluator(const QString& name);
+    Q_INVOKABLE bool nnueAvailable() const;
+
+    // Мат в N ходов, найденный компьютером: > 0 - компьютер ставит мат, < 0 - получает мат, 0 - мата не видно
+    int mateIn() const;
+
+    // Количество лучших вариантов, которые компьютер ищет и показывает (MultiPV)
+    int multiPV() const;
+    void setMultiPV(int newMultiPV);
+    QVariantList candidateLines() const;
+
+    // Режим анализа: непрерывный фоновый поиск в текущей позиции.
+    // Оценка и мат даются с точки зрения белых
+    bool analysisMode() const;
+    void setAnalysisMode(bool enabled);
+    int analysisDepth() const;
+    int analysisEvaluation() const;
+    int analysisMate() const;
+
+    QString status() const;
+
+signals:
+    void piecesChanged();
+    void statusChanged();
+    void gameEnded(const QString& result);
+    void pawnPromotion(int fromX, int fromY, int toX, int toY);
+    void difficultyChanged();
+    void canUndoChanged();
+    void canRedoChanged();
+    void lastMoveChanged();
+    void savedGamesChanged();
+    void vsComputerEnabled();
+    void evaluatorChanged();
+    void mateInChanged();
+    void multiPVChanged();
+    void candidateLinesChanged();
+    void analysisModeChanged();
+    void analysisChanged();
+
+private:
+    enum STATUS {
+        WHITE_TO_MOVE,
+        BLACK_TO_MOVE,
+        WHITE_WON,
+        BLACK_WON,
+        DRAW
+    };
+
+    enum class GameMode {
+        TwoPlayers,
+        VsComputer
+    };
+
+    struct MoveHistoryItem {
+        Move move;
+        Position::Undo undo;
+    };
+
+    Position position;
+    RepetitionHistory repetitionHistory;
+    QPoint selectedPiece;
+    STATUS currentStatus;
+    GameMode gameMode;
+    int m_difficulty; // 1 - легкий, 2 - средний, 3 - сложный
+    int m_mateIn;
+    int m_multiPV;
+    QVariantList m_candidateLines;
+
+    QString gameStartFen;
+    QStack<MoveHistoryItem> moveHistory;
+    QStack<Move> redoHistory;
+    QPoint lastMoveFrom;
+    QPoint lastMoveTo;
+    bool hasLastMoveInfo;
+
+    GameStore gameStore;
+
+    // Фоновый поиск на времени соперника (ponder)
+    Position ponderPosition;
+    std::unique_ptr<TimeManager> ponderTimeManager;
+    std::future<AI::Result> ponderSearch;
+
+    // Фоновый анализ
+    bool m_analysisMode;
+    int m_analysisDepth;
+    int m_analysisEvaluation;
+    int m_analysisMate;
+    int analysisGeneration;
+    std::unique_ptr<TimeManager> analysisTimeManager;
+    std::future<AI::Result> analysisSearch;
+    static constexpr int ANALYSIS_UPDATE_INTERVAL = 200;
+
+    // Фоновое построение битовых баз при первом запуске
+    std::future<void> bitbasesGeneration;
+
+    void updateStatus();
+    static QString statusToString(STATUS status);
+    static std::string statusToResult(STATUS status);
+    static STATUS resultToStatus(const std::string& result, bool whiteToMove);
+    uint8_t getStatus() const;
+    void recordMove(Move move);
+    void setLastMove(int fromX, int fromY, int toX, int toY);
+    int thinkingTime() const;
+    void setCandidateLines(int depth, const std::vector<AI::Line>& lines);
+    static QString moveToString(Move move);
+    void startPondering();
+    void stopPondering();
+    void restartAnalysis();
+    void stopAnalysis();
+    void setAnalysisResult(int generation, int depth, const std::vector<AI::Line>& lines);
+
+    // Вспомогательные методы для сохранения/загрузки
+    void migrateSavedGames();
+    Position deserializePosition(const QString& data);
+    Pgn::Game currentPgnGame() const;
+    bool savedGameToPgn(int slot, Pgn::Game& pgnGame);
+    void restoreGame(const Pgn::Game& pgnGame);
+    static QString localFilePath(const QString& path);
+};
@@ -0,0 +1,172 @@
+#include "BookBuilder.h"
+
+
+BookBuilder::BookBuilder(uint32_t threads, uint64_t memoryBudget, uint16_t maxPly, uint32_t minGames) {
+    this->threads = std::max(1u, threads);
+    this->maxEntries = std::max((uint64_t)2, memoryBudget / ENTRY_MEMORY / 2);
+    this->maxPly = maxPly;
+    this->minGames = std::max(1u, minGames);
+    this->games = 0;
+}
+bool BookBuilder::addFiles(const std::vector<std::string>& paths) {
+    std::atomic<size_t> next = 0;
+    std::atomic<bool> failed = false;
+    uint32_t workers = std::min((size_t)this->threads, paths.size());
+    uint64_t workerEntries = std::max((uint64_t)2, this->maxEntries / std::max(1u, workers));
+
+    std::vector<std::future<std::pair<Table, uint64_t>>> futures;
+    for (uint32_t worker = 0; worker < workers; worker = worker + 1) {
+        futures.push_back(std::async(std::launch::async, [this, &paths, &next, &failed, workerEntries]() {
+            Table local;
+            uint64_t localGames = 0;
+            for (size_t i = next++; i < paths.size(); i = next++) {
+                uint64_t fileGames = this->readFile(paths[i], local, workerEntries);
+                if (fileGames == 0) {
+                    std::cout << "No games read from " << paths[i] << "." << std::endl;
+                    failed = true;
+                    continue;
+                }
+                std::cout << "Read " << fileGames << " games from " << paths[i] << "." << std::endl;
+                localGames = localGames + fileGames;
+            }
+            return std::make_pair(std::move(local), localGames);
+        }));
+    }
+
+    for (auto& future : futures) {
+        auto [local, localGames] = future.get();
+        this->games = this->games + localGames;
+        this->merge(local);
+    }
+
+    return !failed;
+}
+bool BookBuilder::write(const std::string& path) const {
+    std::vector<std::pair<Key, uint32_t>> entries;
+    for (const auto& [key, stats] : this->table) {
+        uint32_t weight = 2 * stats.wins + stats.draws;
+        if (stats.games >= this->minGames and weight > 0) {
+            entries.emplace_back(key, weight);
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right) {
+        if (left.first.key != right.first.key) {
+            return left.first.key < right.first.key;
+        }
+        return left.second > right.second;
+    });
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    for (size_t begin = 0; begin < entries.size();) {
+        size_t end = begin;
+        while (end < entries.size() and entries[end].first.key == entries[begin].first.key) {
+            end = end + 1;
+        }
+
+        uint32_t maxWeight = entries[begin].second;
+        for (size_t i = begin; i < end; i = i + 1) {
+            uint32_t weight = entries[i].second;
+            if (maxWeight > UINT16_MAX) {
+                weight = std::max(1u, (uint32_t)((uint64_t)weight * UINT16_MAX / maxWeight));
+            }
+            writeBigEndian(file, entries[i].first.key, 8);
+            writeBigEndian(file, entries[i].first.move, 2);
+            writeBigEndian(file, weight, 2);
+            writeBigEndian(file, 0, 4);
+        }
+
+        begin = end;
+    }
+
+    return (bool)file;
+}
+uint64_t BookBuilder::getGamesNumber() const {
+    return this->games;
+}
+uint64_t BookBuilder::getEntriesNumber() const {
+    return this->table.size();
+}
+uint64_t BookBuilder::readFile(const std::string& path, Table& table, uint64_t maxEntries) const {
+    uint64_t games = 0;
+
+    Pgn pgn(path);
+    if (!pgn.isOpen()) {
+        return games;
+    }
+
+    Pgn::Game game;
+    while (pgn.read(game)) {
+        uint8_t result = parseResult(game.result);
+        if (!game.legal or game.startFen != Notation::START_FEN or !game.getTag("Variant").empty() or result == RESULT::UNKNOWN or game.moves.empty()) {
+            continue;
+        }
+        this->addGame(game.moves, result, table, maxEntries);
+        games = games + 1;
+    }
+
+    return games;
+}
+void BookBuilder::addGame(const std::vector<Move>& moves, uint8_t result, Table& table, uint64_t maxEntries) const {
+    Position position("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR", Position::NONE, true, true, true, true, SIDE::WHITE, 0, 1);
+    const PolyglotBook* book = PolyglotBook::getPtr();
+
+    for (size_t ply = 0; ply < moves.size() and ply < this->maxPly; ply = ply + 1) {
+        Move move = moves[ply];
+        uint8_t side = position.getSide();
+        Stats stats{1, 0, 0};
+        if (result == RESULT::DRAW) {
+            stats.draws = 1;
+        }
+        else if ((result == RESULT::WHITE_WON) == (side == SIDE::WHITE)) {
+            stats.wins = 1;
+        }
+        addStats(table, {book->getKey(position), PolyglotBook::encodeMove(move)}, stats, maxEntries);
+
+        position.move(move);
+    }
+}
+void BookBuilder::merge(Table& local) {
+    for (const auto& [key, stats] : local) {
+        addStats(this->table, key, stats, this->maxEntries);
+    }
+    local.clear();
+}
+void BookBuilder::addStats(Table& table, Key key, Stats stats, uint64_t maxEntries) {
+    Stats& entry = table[key];
+    entry.games = entry.games + stats.games;
+    entry.wins = entry.wins + stats.wins;
+    entry.draws = entry.draws + stats.draws;
+
+    if (table.size() > maxEntries) {
+        prune(table, maxEntries);
+    }
+}
+void BookBuilder::prune(Table& table, uint64_t maxEntries) {
+    uint64_t target = maxEntries * 3 / 4;
+    for (uint32_t threshold = 2; table.size() > target; threshold = threshold * 2) {
+        std::erase_if(table, [threshold](const auto& entry) {
+            return entry.second.games < threshold;
+        });
+    }
+}
+uint8_t BookBuilder::parseResult(const std::string& token) {
+    if (token == "1-0") {
+        return RESULT::WHITE_WON;
+    }
+    if (token == "0-1") {
+        return RESULT::BLACK_WON;
+    }
+    if (token == "1/2-1/2") {
+        return RESULT::DRAW;
+    }
+    return RESULT::UNKNOWN;
+}
+void BookBuilder::writeBigEndian(std::ofstream& file, uint64_t value, uint8_t bytes) {
+    for (int8_t i = (int8_t)(bytes - 1); i >= 0; i = i - 1) {
+        file.put((char)((value >> (8 * i)) & 0xFF));
+    }
+}
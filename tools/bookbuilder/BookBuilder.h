@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Pgn.h"
+#include "PolyglotBook.h"
+
+
+#pragma once
+
+
+class BookBuilder {
+public:
+    BookBuilder(uint32_t threads, uint64_t memoryBudget, uint16_t maxPly, uint32_t minGames);
+
+    bool addFiles(const std::vector<std::string>& paths);
+    bool write(const std::string& path) const;
+
+    [[nodiscard]] uint64_t getGamesNumber() const;
+    [[nodiscard]] uint64_t getEntriesNumber() const;
+private:
+    struct Key {
+        uint64_t key;
+        uint16_t move;
+
+        friend bool operator ==(Key left, Key right) {
+            return (left.key == right.key and left.move == right.move);
+        }
+    };
+    struct KeyHash {
+        size_t operator()(Key key) const {
+            return key.key ^ (key.move * 0x9E37'79B9'7F4A'7C15);
+        }
+    };
+    struct Stats {
+        uint32_t games;
+        uint32_t wins;
+        uint32_t draws;
+    };
+    using Table = std::unordered_map<Key, Stats, KeyHash>;
+
+    enum RESULT {
+        WHITE_WON,
+        BLACK_WON,
+        DRAW,
+        UNKNOWN
+    };
+
+    uint64_t readFile(const std::string& path, Table& table, uint64_t maxEntries) const;
+    void addGame(const std::vector<Move>& moves, uint8_t result, Table& table, uint64_t maxEntries) const;
+    void merge(Table& table);
+
+    static void addStats(Table& table, Key key, Stats stats, uint64_t maxEntries);
+    static void prune(Table& table, uint64_t maxEntries);
+    static uint8_t parseResult(const std::string& token);
+    static void writeBigEndian(std::ofstream& file, uint64_t value, uint8_t bytes);
+
+    static constexpr uint64_t ENTRY_MEMORY = sizeof(Table::value_type) + 4 * sizeof(void*);
+
+    uint32_t threads;
+    uint64_t maxEntries;
+    uint16_t maxPly;
+    uint32_t minGames;
+
+    uint64_t games;
+    Table table;
+};
@@ -0,0 +1,31 @@
+QT -= core gui
+CONFIG += console c++20
+CONFIG -= app_bundle
+
+TARGET = bookbuilder
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+        BookBuilder.cpp \
+        ../../LegalMoveGen.cpp \
+        ../../Log.cpp \
+        ../../Move.cpp \
+        ../../MoveList.cpp \
+        ../../Notation.cpp \
+        ../../Pgn.cpp \
+        ../../Pieces.cpp \
+        ../../PolyglotBook.cpp \
+        ../../Position.cpp \
+        ../../PsLegalMoveMaskGen.cpp \
+        ../../ZobristHash.cpp
+
+HEADERS += \
+        BookBuilder.h \
+        ../../LegalMoveGen.h \
+        ../../Notation.h \
+        ../../Pgn.h \
+        ../../PolyglotBook.h \
+        ../../PolyglotBookConstants.h \
+        ../../Position.h
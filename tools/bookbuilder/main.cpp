@@ -0,0 +1,45 @@
+#include <thread>
+#include "BookBuilder.h"
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: bookbuilder <output book> <pgn files...> [--memory MB] [--ply N] [--min-games N]" << std::endl;
+        std::cout << "Games with a FEN tag are skipped." << std::endl;
+        return 1;
+    }
+
+    uint64_t memory = 512;
+    uint16_t maxPly = 24;
+    uint32_t minGames = 3;
+    std::vector<std::string> paths;
+    for (int32_t i = 2; i < argc; i = i + 1) {
+        std::string argument = argv[i];
+        if (argument == "--memory" and i + 1 < argc) {
+            memory = std::stoull(argv[++i]);
+        }
+        else if (argument == "--ply" and i + 1 < argc) {
+            maxPly = (uint16_t)std::stoul(argv[++i]);
+        }
+        else if (argument == "--min-games" and i + 1 < argc) {
+            minGames = std::stoul(argv[++i]);
+        }
+        else {
+            paths.push_back(argument);
+        }
+    }
+
+    BookBuilder builder(std::thread::hardware_concurrency(), memory * 1024 * 1024, maxPly, minGames);
+    if (!builder.addFiles(paths)) {
+        std::cout << "Some of the PGN files could not be read." << std::endl;
+    }
+    std::cout << "Read " << builder.getGamesNumber() << " games, " << builder.getEntriesNumber() << " position-move pairs." << std::endl;
+
+    if (!builder.write(argv[1])) {
+        std::cout << "Failed to write " << argv[1] << "." << std::endl;
+        return 1;
+    }
+    std::cout << "Book written to " << argv[1] << "." << std::endl;
+
+    return 0;
+}
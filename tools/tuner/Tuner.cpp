@@ -0,0 +1,283 @@
+#include "Tuner.h"
+
+
+Tuner::Tuner(uint32_t threads) {
+    this->threads = std::max(1u, threads);
+    this->k = 1;
+
+    std::array<int32_t, StaticEvaluator::PARAMETERS_NUMBER> current = StaticEvaluator::getParameters();
+    for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+        this->parameters[i] = current[i];
+    }
+}
+bool Tuner::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty()) {
+            lines.push_back(line);
+        }
+    }
+
+    std::vector<std::future<std::vector<Entry>>> futures;
+    size_t chunk = (lines.size() + this->threads - 1) / this->threads;
+    for (size_t begin = 0; begin < lines.size(); begin = begin + chunk) {
+        size_t end = std::min(lines.size(), begin + chunk);
+        futures.push_back(std::async(std::launch::async, [&lines, begin, end]() {
+            std::vector<Entry> parsed;
+            parsed.reserve(end - begin);
+            for (size_t i = begin; i < end; i = i + 1) {
+                Entry entry{};
+                if (parseEntry(lines[i], entry)) {
+                    parsed.push_back(entry);
+                }
+            }
+            return parsed;
+        }));
+    }
+
+    this->entries.clear();
+    for (auto& future : futures) {
+        std::vector<Entry> parsed = future.get();
+        this->entries.insert(this->entries.end(), parsed.begin(), parsed.end());
+    }
+
+    return !this->entries.empty();
+}
+void Tuner::fitScalingConstant() {
+    double low = 0.1;
+    double high = 4.0;
+    for (uint32_t iteration = 0; iteration < 40; iteration = iteration + 1) {
+        double left = low + (high - low) / 3;
+        double right = high - (high - low) / 3;
+
+        this->k = left;
+        double leftError = this->error(this->parameters);
+        this->k = right;
+        double rightError = this->error(this->parameters);
+
+        if (leftError < rightError) {
+            high = right;
+        }
+        else {
+            low = left;
+        }
+    }
+    this->k = (low + high) / 2;
+
+    std::cout << "Scaling constant K = " << this->k << ". Error: " << this->getError() << std::endl;
+}
+void Tuner::gradientDescent(uint32_t epochs, double learningRate) {
+    static constexpr double BETA1 = 0.9;
+    static constexpr double BETA2 = 0.999;
+    static constexpr double EPSILON = 1e-8;
+
+    Parameters m{};
+    Parameters v{};
+
+    for (uint32_t epoch = 1; epoch <= epochs; epoch = epoch + 1) {
+        Parameters g = this->gradient(this->parameters);
+
+        for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+            m[i] = BETA1 * m[i] + (1 - BETA1) * g[i];
+            v[i] = BETA2 * v[i] + (1 - BETA2) * g[i] * g[i];
+
+            double mCorrected = m[i] / (1 - std::pow(BETA1, epoch));
+            double vCorrected = v[i] / (1 - std::pow(BETA2, epoch));
+            this->parameters[i] = this->parameters[i] - learningRate * mCorrected / (std::sqrt(vCorrected) + EPSILON);
+        }
+
+        if (epoch % 50 == 0 or epoch == epochs) {
+            std::cout << "Epoch " << std::setw(6) << epoch << ". Error: " << std::setprecision(8) << this->getError() << std::endl;
+        }
+    }
+
+    for (double& parameter : this->parameters) {
+        parameter = std::round(parameter);
+    }
+}
+void Tuner::localSearch(uint32_t passes) {
+    double bestError = this->error(this->parameters);
+
+    for (uint32_t pass = 1; pass <= passes; pass = pass + 1) {
+        bool improved = false;
+
+        for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+            for (int32_t step : { 1, -1 }) {
+                Parameters candidate = this->parameters;
+                candidate[i] = candidate[i] + step;
+
+                double candidateError = this->error(candidate);
+                if (candidateError < bestError) {
+                    bestError = candidateError;
+                    this->parameters = candidate;
+                    improved = true;
+                    break;
+                }
+            }
+        }
+
+        std::cout << "Local search pass " << std::setw(4) << pass << ". Error: " << std::setprecision(8) << bestError << std::endl;
+        if (!improved) {
+            break;
+        }
+    }
+}
+bool Tuner::writeHeader(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    auto value = [this](uint8_t index) {
+        return (int32_t)std::lround(this->parameters[index]);
+    };
+    auto array = [&value](uint8_t begin) {
+        std::string result = "{ ";
+        for (uint8_t i = 0; i < 8; i = i + 1) {
+            result = result + std::to_string(value(begin + i)) + (i == 7 ? " }" : ", ");
+        }
+        return result;
+    };
+
+    file << "#include <array>\n";
+    file << "#include <cstdint>\n\n\n";
+    file << "#pragma once\n\n\n";
+    file << "namespace StaticEvaluatorParameters {\n";
+    file << "    struct MATERIAL {\n";
+    file << "        static constexpr int32_t PAWN = " << value(0) << ";\n";
+    file << "        static constexpr int32_t KNIGHT = " << value(1) << ";\n";
+    file << "        static constexpr int32_t BISHOP = " << value(2) << ";\n";
+    file << "        static constexpr int32_t ROOK = " << value(3) << ";\n";
+    file << "        static constexpr int32_t QUEEN = " << value(4) << ";\n";
+    file << "    };\n";
+    file << "    struct MOBILITY {\n";
+    file << "        static constexpr int32_t KNIGHT = " << value(5) << ";\n";
+    file << "        static constexpr int32_t BISHOP = " << value(6) << ";\n";
+    file << "        static constexpr int32_t ROOK = " << value(7) << ";\n";
+    file << "        static constexpr int32_t QUEEN = " << value(8) << ";\n";
+    file << "    };\n";
+    file << "    struct PAWN_STRUCTURE {\n";
+    file << "        static constexpr int32_t DOUBLE_PAWN = " << value(9) << ";\n";
+    file << "        static constexpr int32_t CONNECTED_PAWN = " << value(10) << ";\n";
+    file << "        static constexpr std::array<int32_t, 8> DEFAULT_PAWN_PROMOTION = " << array(11) << ";\n";
+    file << "        static constexpr std::array<int32_t, 8> PASSED_PAWN_PROMOTION = " << array(19) << ";\n";
+    file << "    };\n";
+    file << "    struct KING_SAFETY {\n";
+    file << "        static constexpr int32_t KNIGHT = " << value(27) << ";\n";
+    file << "        static constexpr int32_t BISHOP = " << value(28) << ";\n";
+    file << "        static constexpr int32_t ROOK = " << value(29) << ";\n";
+    file << "        static constexpr int32_t QUEEN = " << value(30) << ";\n";
+    file << "    };\n";
+    file << "    struct ENDGAME {\n";
+    file << "        static constexpr int32_t MAXIMUM_PIECES_FOR_ENDGAME = " << StaticEvaluatorParameters::ENDGAME::MAXIMUM_PIECES_FOR_ENDGAME << ";\n";
+    file << "        static constexpr int32_t PROXIMITY_KINGS = " << value(31) << ";\n";
+    file << "        static constexpr int32_t DISTANCE_WEAK_KING_MIDDLE = " << value(32) << ";\n";
+    file << "    };\n";
+    file << "}\n";
+
+    return true;
+}
+size_t Tuner::getEntriesNumber() const {
+    return this->entries.size();
+}
+double Tuner::getError() const {
+    return this->error(this->parameters);
+}
+bool Tuner::parseEntry(const std::string& line, Entry& entry) {
+    size_t boardEnd = line.find(' ');
+    if (boardEnd == std::string::npos) {
+        return false;
+    }
+
+    double result = parseResult(line.substr(boardEnd));
+    if (result < 0) {
+        return false;
+    }
+
+    std::array<int32_t, StaticEvaluator::PARAMETERS_NUMBER> features = StaticEvaluator::getFeatures({ line.substr(0, boardEnd) });
+    for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+        entry.features[i] = (int16_t)features[i];
+    }
+    entry.result = (float)result;
+
+    return true;
+}
+double Tuner::parseResult(const std::string& line) {
+    if (line.find("1/2-1/2") != std::string::npos or line.find("[0.5]") != std::string::npos) {
+        return 0.5;
+    }
+    if (line.find("1-0") != std::string::npos or line.find("[1.0]") != std::string::npos) {
+        return 1;
+    }
+    if (line.find("0-1") != std::string::npos or line.find("[0.0]") != std::string::npos) {
+        return 0;
+    }
+    return -1;
+}
+double Tuner::evaluate(const Entry& entry, const Parameters& parameters) {
+    double evaluation = 0;
+    for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+        evaluation = evaluation + parameters[i] * entry.features[i];
+    }
+    return evaluation;
+}
+double Tuner::sigmoid(double evaluation, double k) {
+    return 1 / (1 + std::pow(10.0, -k * evaluation / 400));
+}
+double Tuner::error(const Parameters& parameters) const {
+    double sum = this->reduce([this, &parameters](const Entry& entry, double& accumulator) {
+        double difference = entry.result - sigmoid(evaluate(entry, parameters), this->k);
+        accumulator = accumulator + difference * difference;
+    }, 0.0);
+    return sum / (double)this->entries.size();
+}
+Tuner::Parameters Tuner::gradient(const Parameters& parameters) const {
+    Parameters sum = this->reduce([this, &parameters](const Entry& entry, Parameters& accumulator) {
+        double s = sigmoid(evaluate(entry, parameters), this->k);
+        double factor = (s - entry.result) * s * (1 - s);
+        for (uint8_t i = 0; i < StaticEvaluator::PARAMETERS_NUMBER; i = i + 1) {
+            accumulator[i] = accumulator[i] + factor * entry.features[i];
+        }
+    }, Parameters{});
+
+    double scale = 2 * std::log(10.0) * this->k / 400 / (double)this->entries.size();
+    for (double& value : sum) {
+        value = value * scale;
+    }
+    return sum;
+}
+template<typename Result, typename Function>
+Result Tuner::reduce(Function function, Result init) const {
+    std::vector<std::future<Result>> futures;
+    size_t chunk = (this->entries.size() + this->threads - 1) / this->threads;
+    for (size_t begin = 0; begin < this->entries.size(); begin = begin + chunk) {
+        size_t end = std::min(this->entries.size(), begin + chunk);
+        futures.push_back(std::async(std::launch::async, [this, &function, init, begin, end]() {
+            Result accumulator = init;
+            for (size_t i = begin; i < end; i = i + 1) {
+                function(this->entries[i], accumulator);
+            }
+            return accumulator;
+        }));
+    }
+
+    Result total = init;
+    for (auto& future : futures) {
+        Result partial = future.get();
+        if constexpr (std::is_arithmetic_v<Result>) {
+            total = total + partial;
+        }
+        else {
+            for (size_t i = 0; i < total.size(); i = i + 1) {
+                total[i] = total[i] + partial[i];
+            }
+        }
+    }
+    return total;
+}
@@ -0,0 +1,47 @@
+#include <cmath>
+#include <future>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "StaticEvaluator.h"
+
+
+#pragma once
+
+
+class Tuner {
+public:
+    explicit Tuner(uint32_t threads);
+
+    bool load(const std::string& path);
+    void fitScalingConstant();
+    void gradientDescent(uint32_t epochs, double learningRate);
+    void localSearch(uint32_t passes);
+    bool writeHeader(const std::string& path) const;
+
+    [[nodiscard]] size_t getEntriesNumber() const;
+    [[nodiscard]] double getError() const;
+private:
+    struct Entry {
+        std::array<int16_t, StaticEvaluator::PARAMETERS_NUMBER> features;
+        float result;
+    };
+    using Parameters = std::array<double, StaticEvaluator::PARAMETERS_NUMBER>;
+
+    static bool parseEntry(const std::string& line, Entry& entry);
+    static double parseResult(const std::string& line);
+    static double evaluate(const Entry& entry, const Parameters& parameters);
+    static double sigmoid(double evaluation, double k);
+
+    [[nodiscard]] double error(const Parameters& parameters) const;
+    [[nodiscard]] Parameters gradient(const Parameters& parameters) const;
+
+    template<typename Result, typename Function>
+    Result reduce(Function function, Result init) const;
+
+    uint32_t threads;
+    double k;
+    Parameters parameters;
+    std::vector<Entry> entries;
+};
@@ -0,0 +1,34 @@
+#include <thread>
+#include "Tuner.h"
+
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: tuner <positions file> <output header> [epochs] [learning rate] [local search passes]" << std::endl;
+        std::cout << "Each line of the positions file is a board FEN followed by the game result: 1-0, 0-1, 1/2-1/2, [1.0], [0.5] or [0.0]." << std::endl;
+        return 1;
+    }
+
+    uint32_t epochs = (argc > 3) ? std::stoul(argv[3]) : 1000;
+    double learningRate = (argc > 4) ? std::stod(argv[4]) : 1.0;
+    uint32_t passes = (argc > 5) ? std::stoul(argv[5]) : 0;
+
+    Tuner tuner(std::thread::hardware_concurrency());
+    if (!tuner.load(argv[1])) {
+        std::cout << "Failed to load positions from " << argv[1] << "." << std::endl;
+        return 1;
+    }
+    std::cout << "Loaded " << tuner.getEntriesNumber() << " positions." << std::endl;
+
+    tuner.fitScalingConstant();
+    tuner.gradientDescent(epochs, learningRate);
+    tuner.localSearch(passes);
+
+    if (!tuner.writeHeader(argv[2])) {
+        std::cout << "Failed to write " << argv[2] << "." << std::endl;
+        return 1;
+    }
+    std::cout << "Parameters written to " << argv[2] << "." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+QT -= core gui
+CONFIG += console c++20
+CONFIG -= app_bundle
+
+TARGET = tuner
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+        main.cpp \
+        Tuner.cpp \
+        ../../Pieces.cpp \
+        ../../PsLegalMoveMaskGen.cpp \
+        ../../StaticEvaluator.cpp
+
+HEADERS += \
+        Tuner.h \
+        ../../StaticEvaluator.h \
+        ../../StaticEvaluatorParameters.h
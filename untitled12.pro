@@ -1,83 +1,120 @@
-QT += quick
-QT += quick multimedia
-CONFIG += c++20
-
-SOURCES += \
-        AI.cpp \
-        LegalMoveGen.cpp \
-        LegalMoveGenTester.cpp \
-        Move.cpp \
-        MoveList.cpp \
-        MoveSorter.cpp \
-        Pieces.cpp \
-        Position.cpp \
-        PsLegalMoveMaskGen.cpp \
-        RepetitionHistory.cpp \
-        SearchInterrupter.cpp \
-        StaticEvaluator.cpp \
-        TranspositionTable.cpp \
-        ZobristHash.cpp \
-        chessengine.cpp \
-        main.cpp \
-        resourcemanager.cpp
-
-resources.files = main.qml 
-resources.prefix = /$${TARGET}
-RESOURCES += resources \
-    qml.qrc
-
-# Additional import path used to resolve QML modules in Qt Creator's code model
-QML_IMPORT_PATH =
-
-# Additional import path used to resolve QML modules just for Qt Quick Designer
-QML_DESIGNER_IMPORT_PATH =
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
-
-DISTFILES += \
-    ChessBoard.qml \
-    ChessPiece.qml \
-    resources/images/chessmen/black/bishop.png \
-    resources/images/chessmen/black/king.png \
-    resources/images/chessmen/black/knight.png \
-    resources/images/chessmen/black/pawn.png \
-    resources/images/chessmen/black/queen.png \
-    resources/images/chessmen/black/rook.png \
-    resources/images/chessmen/white/bishop.png \
-    resources/images/chessmen/white/king.png \
-    resources/images/chessmen/white/knight.png \
-    resources/images/chessmen/white/pawn.png \
-    resources/images/chessmen/white/queen.png \
-    resources/images/chessmen/white/rook.png \
-    resources/images/fon2.png \
-    resources/images/logotype.png \
-    resources/sounds/capture.ogg \
-    resources/sounds/message.ogg \
-    resources/sounds/move.ogg
-
-HEADERS += \
-    AI.h \
-    Bitboard.h \
-    KingMasks.h \
-    KnightMasks.h \
-    LegalMoveGen.h \
-    LegalMoveGenTester.h \
-    Move.h \
-    MoveList.h \
-    MoveSorter.h \
-    PassedPawnMasks.h \
-    Pieces.h \
-    Position.h \
-    PsLegalMoveMaskGen.h \
-    RepetitionHistory.h \
-    SearchInterrupter.h \
-    SlidersMasks.h \
-    StaticEvaluator.h \
-    TranspositionTable.h \
-    ZobristHash.h \
-    ZobristHashConstants.h \
-    chessengine.h \
-    resourcemanager.h
+QT += quick
+QT += quick multimedia
+CONFIG += c++20
+
+# NNUE kernels are chosen at compile time: AVX2, SSE4.1 or scalar fallback.
+# Enable the instruction set of the target machine, e.g. QMAKE_CXXFLAGS += -mavx2
+
+# Engine log messages above this level are compiled out (see Log.h).
+DEFINES += LOG_LEVEL=Log::LEVEL::INFO
+
+# Debug builds may recompute the Zobrist hash from scratch every N moves and
+# abort on mismatch with the incremental value, e.g. DEFINES += ZOBRIST_HASH_VERIFICATION=64
+
+SOURCES += \
+        AI.cpp \
+        Bitbases.cpp \
+        GameStore.cpp \
+        LegalMoveGen.cpp \
+        LegalMoveGenTester.cpp \
+        Log.cpp \
+        Move.cpp \
+        MoveList.cpp \
+        MoveSorter.cpp \
+        NNUE.cpp \
+        Notation.cpp \
+        Pgn.cpp \
+        PgnTester.cpp \
+        Pieces.cpp \
+        PolyglotBook.cpp \
+        PolyglotBookTester.cpp \
+        Position.cpp \
+        PsLegalMoveMaskGen.cpp \
+        RepetitionHistory.cpp \
+        SearchInterrupter.cpp \
+        StaticEvaluator.cpp \
+        Syzygy.cpp \
+        SyzygyTester.cpp \
+        TimeManager.cpp \
+        TranspositionTable.cpp \
+        ZobristHash.cpp \
+        chessengine.cpp \
+        main.cpp \
+        resourcemanager.cpp
+
+resources.files = main.qml 
+resources.prefix = /$${TARGET}
+RESOURCES += resources \
+    qml.qrc
+
+# Additional import path used to resolve QML modules in Qt Creator's code model
+QML_IMPORT_PATH =
+
+# Additional import path used to resolve QML modules just for Qt Quick Designer
+QML_DESIGNER_IMPORT_PATH =
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
+
+DISTFILES += \
+    ChessBoard.qml \
+    ChessPiece.qml \
+    resources/images/chessmen/black/bishop.png \
+    resources/images/chessmen/black/king.png \
+    resources/images/chessmen/black/knight.png \
+    resources/images/chessmen/black/pawn.png \
+    resources/images/chessmen/black/queen.png \
+    resources/images/chessmen/black/rook.png \
+    resources/images/chessmen/white/bishop.png \
+    resources/images/chessmen/white/king.png \
+    resources/images/chessmen/white/knight.png \
+    resources/images/chessmen/white/pawn.png \
+    resources/images/chessmen/white/queen.png \
+    resources/images/chessmen/white/rook.png \
+    resources/images/fon2.png \
+    resources/images/logotype.png \
+    resources/sounds/capture.ogg \
+    resources/sounds/message.ogg \
+    resources/sounds/move.ogg
+
+HEADERS += \
+    AI.h \
+    BetweenMasks.h \
+    Bitbases.h \
+    Bitboard.h \
+    GameStore.h \
+    KingMasks.h \
+    KnightMasks.h \
+    LegalMoveGen.h \
+    LegalMoveGenTester.h \
+    Log.h \
+    Move.h \
+    MoveList.h \
+    MoveSorter.h \
+    NNUE.h \
+    Notation.h \
+    Pgn.h \
+    PgnTester.h \
+    PassedPawnMasks.h \
+    PawnMasks.h \
+    Pieces.h \
+    PolyglotBook.h \
+    PolyglotBookConstants.h \
+    PolyglotBookTester.h \
+    Position.h \
+    PsLegalMoveMaskGen.h \
+    RepetitionHistory.h \
+    SearchInterrupter.h \
+    SlidersMasks.h \
+    StaticEvaluator.h \
+    StaticEvaluatorParameters.h \
+    Syzygy.h \
+    SyzygyTester.h \
+    TimeManager.h \
+    TranspositionTable.h \
+    ZobristHash.h \
+    ZobristHashConstants.h \
+    chessengine.h \
+    resourcemanager.h